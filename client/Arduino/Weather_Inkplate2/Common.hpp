@@ -95,6 +95,34 @@ size_t convert (Variables &vars, const JsonVariantConst& json) {
 
 // -----------------------------------------------------------------------------------------------
 
+// FNV-1a, to tell whether something changed between wakes without keeping it
+uint32_t hash_fnv (const String &str, uint32_t hash = 2166136261u) {
+    for (const char *c = str.c_str (); *c; c ++)
+        hash = (hash ^ (uint8_t) *c) * 16777619u;
+    return hash;
+}
+
+// -----------------------------------------------------------------------------------------------
+
+#define NIBBLE_TO_HEX_CHAR(nibble) ((char) ((nibble) < 10 ? '0' + (nibble) : 'A' + ((nibble) - 10)))
+
+String query (const Variables &vars) {
+    String str;
+    for (const auto& pair : vars) {
+        if (!str.isEmpty ())
+            str += '&';
+        str += pair.first + "=";
+        for (const char *c = pair.second.c_str (); *c; c ++)
+            if (isalnum (*c) || *c == '-' || *c == '_' || *c == '.' || *c == '~')
+                str += *c;
+            else
+                str += '%', str += NIBBLE_TO_HEX_CHAR (((uint8_t) *c) >> 4), str += NIBBLE_TO_HEX_CHAR (((uint8_t) *c) & 0x0F);
+    }
+    return str;
+}
+
+// -----------------------------------------------------------------------------------------------
+
 #include <ctime>
 
 String time_iso (const std::time_t t) {
@@ -118,7 +146,6 @@ String time_iso (const std::time_t t) {
 #include <Arduino.h>
 
 String identify (void) {
-    #define NIBBLE_TO_HEX_CHAR(nibble) ((char) ((nibble) < 10 ? '0' + (nibble) : 'A' + ((nibble) - 10)))
     #define BYTE_TO_HEX(byte) NIBBLE_TO_HEX_CHAR ((byte) >> 4), NIBBLE_TO_HEX_CHAR ((byte) & 0x0F)
     uint8_t macaddr [6];
     esp_read_mac (macaddr, ESP_MAC_WIFI_STA);
@@ -13,11 +13,45 @@
 #define DEFAULT_NETWORK_CLIENT_TIMEOUT 5000
 #define DEFAULT_NETWORK_CLIENT_USERAGENT "WeatherDisplay (Inkplate2; ESP32)"
 
+#define DEFAULT_POWER_MHZ_BURST 240 // parse and render
+#define DEFAULT_POWER_MHZ_RADIO 80 // radio requires at least 80
+#define DEFAULT_POWER_MHZ_WAIT 40 // panel busy, radio off
+#define DEFAULT_POWER_SLEEP_THRESHOLD 20 // light sleep for waits (ms) at or above this
+
+#define DEFAULT_PANEL_REFRESH_TIMEOUT 45000 // ms the panel may be busy refreshing before it is abandoned
+#define DEFAULT_PANEL_REFRESH_MINIMUM 2000 // ms, a refresh ending sooner than this has not really happened
+#define DEFAULT_PANEL_REFRESH_DEVIATION 0.5f // fraction from the typical time beyond which a refresh is anomalous
+#define DEFAULT_PANEL_REFRESH_SMOOTHING 0.25f // weight of each refresh in the typical time
+
+#define DEFAULT_SCHEDULE_MIN 120 // secs
+#define DEFAULT_SCHEDULE_MAX 1800 // secs
+#define DEFAULT_SCHEDULE_GROWTH 50 // % longer each wake without a visible change
+#define DEFAULT_SCHEDULE_MARGIN 10 // secs after the server's expected data update
+#define DEFAULT_SCHEDULE_SLOT_WINDOW 60 // secs over which the fleet's wakes are spread after a data update
+#define DEFAULT_SCHEDULE_DRIFT_ELAPSED 60 // secs between fetches at least, for a drift measurement
+#define DEFAULT_SCHEDULE_DRIFT_LIMIT 0.2f // measurements further than this from 1 are discarded
+#define DEFAULT_SCHEDULE_DRIFT_SMOOTHING 0.25f // weight of each new measurement
+
+#define DEFAULT_RENDER_RETAINED 16 // renderers whose last shown value is kept for their change policy
+#define DEFAULT_RENDER_ITEMS 24 // renderers kept in the retained display list, all drawn if more
+#define DEFAULT_RENDER_RTC 6144 // bytes of RTC slow memory (8 KB, 512 reserved for the ULP) the display list may keep
+
+#define DEFAULT_BATTERY_PIN -1 // ADC pin wired to the cell through a divider, -1 if none (mains, not governed)
+#define DEFAULT_BATTERY_DIVIDER 2.0f // cell voltage over ADC pin voltage
+#define DEFAULT_BATTERY_CAPACITY 600 // mAh
+#define DEFAULT_BATTERY_SLEEP_CURRENT 30 // uA in deep sleep
+#define DEFAULT_BATTERY_HISTORY 8 // readings averaged, one per wake
+#define DEFAULT_BATTERY_SHOWN 24 // values remembered to detect minor changes
+#define DEFAULT_BATTERY_MINOR_CHANGE 1.0f // change in a shown value below this is minor
+#define DEFAULT_BATTERY_MINOR_SKIPS 6 // consecutive refreshes skipped at most
+
 #define DEFAULT_SOFTWARE_TIME (60*60*12) // check every 12 hours
 #define DEFAULT_SOFTWARE_TYPE "weatherdisplay-inkplate2-esp32"
 #define DEFAULT_SOFTWARE_VERS "1.5.1"
 #define DEFAULT_SOFTWARE_JSON "http://weather.local/images/images.json"
 
+//#define DEFAULT_SETS_BUILTIN // Sets.hpp, generated by tools/setsConvert.py for one device, replaces 'sets' download and storage on it
+
 // -----------------------------------------------------------------------------------------------
 
 const Variables DEFAULT_CONFIG = {
@@ -0,0 +1,80 @@
+
+// -----------------------------------------------------------------------------------------------
+
+// generated by tools/fontSubset.py from fonts/, do not edit
+
+const uint8_t FreeSansBold9pt7bBitmaps [145] PROGMEM = {
+    0xFF,0xC0,0xFC,0x3E,0x3F,0x9D,0xDC,0x7E,0x3F,0x1F,0x8F,0xC7,0xE3,0xF1,0xDD,0xCF,
+    0xE3,0xE0,0x08,0xFF,0xF3,0x9C,0xE7,0x39,0xCE,0x73,0x80,0x3E,0x3F,0xB8,0xFC,0x70,
+    0x38,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x0F,0xF7,0xF8,0x3C,0x7F,0xE7,0xE7,0x07,0x0C,
+    0x0E,0x07,0x07,0xE7,0xE7,0x7E,0x3C,0x0E,0x1E,0x1E,0x2E,0x2E,0x4E,0x4E,0x8E,0xFF,
+    0xFF,0x0E,0x0E,0x0E,0x7F,0x3F,0x90,0x18,0x0D,0xE7,0xFB,0x9E,0x07,0x03,0x81,0xF1,
+    0xFF,0xE7,0xC0,0x3E,0x3F,0x9C,0xFC,0x0E,0xE7,0xFB,0xDF,0xC7,0xE3,0xF1,0xDD,0xEF,
+    0xE3,0xE0,0xFF,0xFF,0xC0,0xE0,0xE0,0x60,0x70,0x30,0x38,0x1C,0x0C,0x0E,0x07,0x03,
+    0x80,0x3F,0x1F,0xEE,0x3F,0x87,0xE3,0xCF,0xC7,0xFB,0xCF,0xE1,0xF8,0x7F,0x3D,0xFE,
+    0x3F,0x00,0x3E,0x3F,0xBD,0xDC,0x7E,0x3F,0x1F,0xDE,0xFF,0x3B,0x81,0xF9,0xCF,0xE3,
+    0xC0,
+};
+const GFXglyph FreeSansBold9pt7bGlyphs [26] PROGMEM = {
+    {     0,   0,   0,   5,    0,    1 }, // 0x20 ' '
+    {     0,   0,   0,   0,    0,    0 }, // 0x21
+    {     0,   0,   0,   0,    0,    0 }, // 0x22
+    {     0,   0,   0,   0,    0,    0 }, // 0x23
+    {     0,   0,   0,   0,    0,    0 }, // 0x24
+    {     0,   0,   0,   0,    0,    0 }, // 0x25
+    {     0,   0,   0,   0,    0,    0 }, // 0x26
+    {     0,   0,   0,   0,    0,    0 }, // 0x27
+    {     0,   0,   0,   0,    0,    0 }, // 0x28
+    {     0,   0,   0,   0,    0,    0 }, // 0x29
+    {     0,   0,   0,   0,    0,    0 }, // 0x2A
+    {     0,   0,   0,   0,    0,    0 }, // 0x2B
+    {     0,   0,   0,   0,    0,    0 }, // 0x2C
+    {     0,   5,   2,   6,    0,   -5 }, // 0x2D '-'
+    {     2,   3,   2,   4,    1,   -1 }, // 0x2E '.'
+    {     0,   0,   0,   0,    0,    0 }, // 0x2F
+    {     3,   9,  13,  10,    1,  -12 }, // 0x30 '0'
+    {    18,   5,  13,  10,    2,  -12 }, // 0x31 '1'
+    {    27,   9,  13,  10,    1,  -12 }, // 0x32 '2'
+    {    42,   8,  13,  10,    1,  -12 }, // 0x33 '3'
+    {    55,   8,  13,  10,    2,  -12 }, // 0x34 '4'
+    {    68,   9,  13,  10,    1,  -12 }, // 0x35 '5'
+    {    83,   9,  13,  10,    1,  -12 }, // 0x36 '6'
+    {    98,   9,  13,  10,    0,  -12 }, // 0x37 '7'
+    {   113,  10,  13,  10,    0,  -12 }, // 0x38 '8'
+    {   130,   9,  13,  10,    1,  -12 }, // 0x39 '9'
+};
+const GFXfont FreeSansBold9pt7b PROGMEM = { (uint8_t *) FreeSansBold9pt7bBitmaps, (GFXglyph *) FreeSansBold9pt7bGlyphs, 0x20, 0x39, 22 };
+
+const uint8_t Org_01Bitmaps [9] PROGMEM = {
+    0xFC,0x7F,0x08,0x00,0xF1,0xFF,0x8F,0x99,0x90,
+};
+const GFXglyph Org_01Glyphs [25] PROGMEM = {
+    {     0,   5,   5,   6,    0,   -4 }, // 0x50 'P'
+    {     0,   0,   0,   0,    0,    0 }, // 0x51
+    {     0,   0,   0,   0,    0,    0 }, // 0x52
+    {     0,   0,   0,   0,    0,    0 }, // 0x53
+    {     0,   0,   0,   0,    0,    0 }, // 0x54
+    {     0,   0,   0,   0,    0,    0 }, // 0x55
+    {     0,   0,   0,   0,    0,    0 }, // 0x56
+    {     0,   0,   0,   0,    0,    0 }, // 0x57
+    {     0,   0,   0,   0,    0,    0 }, // 0x58
+    {     0,   0,   0,   0,    0,    0 }, // 0x59
+    {     0,   0,   0,   0,    0,    0 }, // 0x5A
+    {     0,   0,   0,   0,    0,    0 }, // 0x5B
+    {     0,   0,   0,   0,    0,    0 }, // 0x5C
+    {     0,   0,   0,   0,    0,    0 }, // 0x5D
+    {     0,   0,   0,   0,    0,    0 }, // 0x5E
+    {     0,   0,   0,   0,    0,    0 }, // 0x5F
+    {     0,   0,   0,   0,    0,    0 }, // 0x60
+    {     4,   4,   4,   5,    0,   -3 }, // 0x61 'a'
+    {     0,   0,   0,   0,    0,    0 }, // 0x62
+    {     0,   0,   0,   0,    0,    0 }, // 0x63
+    {     0,   0,   0,   0,    0,    0 }, // 0x64
+    {     0,   0,   0,   0,    0,    0 }, // 0x65
+    {     0,   0,   0,   0,    0,    0 }, // 0x66
+    {     0,   0,   0,   0,    0,    0 }, // 0x67
+    {     6,   4,   5,   5,    0,   -4 }, // 0x68 'h'
+};
+const GFXfont Org_01 PROGMEM = { (uint8_t *) Org_01Bitmaps, (GFXglyph *) Org_01Glyphs, 0x50, 0x68, 7 };
+
+// -----------------------------------------------------------------------------------------------
@@ -0,0 +1,35 @@
+
+// -----------------------------------------------------------------------------------------------
+
+// generated by tools/glyphConvert.py from fonts/, do not edit
+
+static const uint16_t DEFAULT_GLYPHS_FreeSansBold9pt7b_OFFSETS [13] PROGMEM = {
+    0,5,GLYPH_UNCACHED,8,26,36,54,70,
+    86,104,122,140,160,
+};
+static const uint8_t DEFAULT_GLYPHS_FreeSansBold9pt7b_BITMAP [178] PROGMEM = {
+    0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x1f,0xc0,0x7f,0xf0,0xff,0xf8,0xe0,0x38,0xc0,0x18,0xe0,0x38,0xff,0xf8,0x7f,0xf0,0x1f,0xc0,
+    0xff,0xf8,0x7f,0xf8,0x3f,0xf8,0x30,0x00,0x30,0x00,0x3c,0x18,0x7e,0x18,0xff,0x18,0xc3,0x98,0xc1,0xd8,0xc0,0xf8,0xf0,0x78,0x70,0x38,
+    0x30,0x00,0x79,0xe0,0x7b,0xf0,0xff,0xf8,0xc6,0x18,0xc0,0x18,0xf0,0x78,0x70,0x70,0x30,0x60,0x00,0xc0,0xff,0xf8,0xff,0xf8,0xff,0xf8,
+    0x60,0xc0,0x18,0xc0,0x06,0xc0,0x01,0xc0,0x03,0xe0,0xc7,0xf0,0xcf,0xf0,0xce,0x38,0xcc,0x18,0xcc,0x18,0xc6,0x18,0xfe,0x38,0x1e,0x30,
+    0x23,0xe0,0x67,0xf0,0xef,0xf8,0xce,0x38,0xcc,0x18,0xe6,0x38,0xff,0xf8,0x7f,0xf0,0x1f,0xc0,0xe0,0x00,0xf0,0x00,0xfc,0x00,0xdf,0x80,
+    0xc7,0xf8,0xc1,0xf8,0xc0,0x38,0xc0,0x00,0xc0,0x00,0x39,0xe0,0x7b,0xf0,0xff,0xf8,0xef,0x38,0xc6,0x18,0xc6,0x18,0xc7,0x38,0xff,0xf8,
+    0x7b,0xf0,0x39,0xe0,0x1f,0xc0,0x7f,0xf0,0xff,0xf0,0xe3,0x38,0xc1,0x98,0xe3,0x98,0xff,0xb8,0x7f,0x30,0x3e,0x20,
+};
+
+static const uint16_t DEFAULT_GLYPHS_Org_01_OFFSETS [25] PROGMEM = {
+    0,GLYPH_UNCACHED,GLYPH_UNCACHED,GLYPH_UNCACHED,GLYPH_UNCACHED,GLYPH_UNCACHED,GLYPH_UNCACHED,GLYPH_UNCACHED,
+    GLYPH_UNCACHED,GLYPH_UNCACHED,GLYPH_UNCACHED,GLYPH_UNCACHED,GLYPH_UNCACHED,GLYPH_UNCACHED,GLYPH_UNCACHED,GLYPH_UNCACHED,
+    GLYPH_UNCACHED,5,GLYPH_UNCACHED,GLYPH_UNCACHED,GLYPH_UNCACHED,GLYPH_UNCACHED,GLYPH_UNCACHED,GLYPH_UNCACHED,
+    9,
+};
+static const uint8_t DEFAULT_GLYPHS_Org_01_BITMAP [13] PROGMEM = {
+    0xe0,0xa0,0xa0,0xa0,0xf8,0xf0,0xb0,0xb0,0xb0,0x78,0x40,0x40,0xf8,
+};
+
+static const GlyphCache DEFAULT_GLYPHS [2] = {
+    { &FreeSansBold9pt7b, 1, 0x2D, 0x39, DEFAULT_GLYPHS_FreeSansBold9pt7b_OFFSETS, DEFAULT_GLYPHS_FreeSansBold9pt7b_BITMAP },
+    { &Org_01, 1, 0x50, 0x68, DEFAULT_GLYPHS_Org_01_OFFSETS, DEFAULT_GLYPHS_Org_01_BITMAP },
+};
+
+// -----------------------------------------------------------------------------------------------
@@ -0,0 +1,45 @@
+
+// -----------------------------------------------------------------------------------------------
+
+// generated by tools/metricsConvert.py from fonts/, do not edit
+
+// per character from first to last: the cursor advance, and the right edge of the ink from the cursor
+struct FontMetrics { uint8_t first, last, yAdvance; const uint8_t *advance; const int8_t *extent; };
+
+static constexpr uint8_t DEFAULT_METRICS_FreeSansBold9pt7b_ADVANCE [95] = {
+    5,6,9,10,10,16,13,5,6,6,7,11,4,6,4,5,
+    10,10,10,10,10,10,10,10,10,10,4,4,11,11,11,11,
+    18,13,13,13,13,12,11,14,13,6,10,13,11,16,14,14,
+    12,14,13,12,12,13,12,17,12,12,11,6,5,6,11,10,
+    5,10,11,10,11,10,6,11,11,5,5,10,5,16,11,11,
+    11,11,7,10,6,11,10,14,10,10,9,7,5,7,9,
+};
+static constexpr int8_t DEFAULT_METRICS_FreeSansBold9pt7b_EXTENT [95] = {
+    0,5,8,10,10,16,13,4,7,6,6,9,4,5,4,5,
+    10,7,10,9,10,10,10,9,10,10,4,4,10,10,10,10,
+    16,12,12,13,13,10,10,12,12,4,9,13,9,15,12,14,
+    12,14,13,12,11,12,12,17,12,12,10,5,5,4,9,10,
+    3,11,11,10,10,10,6,10,10,4,4,10,4,15,10,11,
+    11,10,7,10,6,10,10,14,10,10,9,5,3,6,8,
+};
+static constexpr FontMetrics DEFAULT_METRICS_FreeSansBold9pt7b = { 0x20, 0x7E, 22, DEFAULT_METRICS_FreeSansBold9pt7b_ADVANCE, DEFAULT_METRICS_FreeSansBold9pt7b_EXTENT };
+
+static constexpr uint8_t DEFAULT_METRICS_Org_01_ADVANCE [95] = {
+    6,2,4,6,6,6,6,2,3,3,4,4,2,5,2,6,
+    6,2,6,6,6,6,6,6,6,6,2,2,4,5,4,6,
+    6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+    6,6,6,6,6,6,6,6,6,6,6,3,6,3,4,6,
+    2,5,5,5,5,5,4,5,5,2,3,5,2,6,5,5,
+    5,5,5,5,6,5,5,6,5,5,5,4,2,4,6,
+};
+static constexpr int8_t DEFAULT_METRICS_Org_01_EXTENT [95] = {
+    0,1,3,5,5,5,5,1,2,2,3,3,1,4,1,5,
+    5,1,5,5,5,5,5,5,5,5,1,1,3,4,3,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,2,5,2,3,5,
+    1,4,4,4,4,4,3,4,4,1,2,4,1,5,4,4,
+    4,4,4,4,5,4,4,5,4,4,4,3,1,3,5,
+};
+static constexpr FontMetrics DEFAULT_METRICS_Org_01 = { 0x20, 0x7E, 7, DEFAULT_METRICS_Org_01_ADVANCE, DEFAULT_METRICS_Org_01_EXTENT };
+
+// -----------------------------------------------------------------------------------------------
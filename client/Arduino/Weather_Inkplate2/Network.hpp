@@ -7,6 +7,71 @@
 
 #include <ArduinoJson.h>
 
+#include <esp_wifi.h>
+
+// -----------------------------------------------------------------------------------------------
+
+// radio settings for the next association, chosen from the RSSI and retries of the last one (kept in
+// RTC memory across deep sleep): step down quickly after a failure, step up one level per wake
+
+class RadioPolicy {
+    struct Level {
+        const char *name;
+        const int8_t rssi;
+        const wifi_power_t power;
+        const wifi_ps_type_t save;
+        const uint8_t protocol;
+    };
+    static constexpr Level _levels [] = {
+        { "full",   -128, WIFI_POWER_19_5dBm, WIFI_PS_MIN_MODEM, WIFI_PROTOCOL_11B | WIFI_PROTOCOL_11G | WIFI_PROTOCOL_11N },
+        { "fair",   -72,  WIFI_POWER_15dBm,   WIFI_PS_MIN_MODEM, WIFI_PROTOCOL_11B | WIFI_PROTOCOL_11G | WIFI_PROTOCOL_11N },
+        { "good",   -64,  WIFI_POWER_11dBm,   WIFI_PS_MAX_MODEM, WIFI_PROTOCOL_11G | WIFI_PROTOCOL_11N },
+        { "strong", -56,  WIFI_POWER_8_5dBm,  WIFI_PS_MAX_MODEM, WIFI_PROTOCOL_11G | WIFI_PROTOCOL_11N },
+    };
+    static constexpr int _level_count = sizeof (_levels) / sizeof (_levels [0]);
+    struct State {
+        uint8_t level;
+        int8_t rssi;
+        uint8_t retries, failures;
+    };
+    static State _state;
+
+public:
+    // power save goes through WiFi.setSleep, as the core sets it again when the station starts
+    static void apply () {
+        const Level &level = _levels [_state.level];
+        const bool applied = WiFi.setTxPower (level.power) && WiFi.setSleep (level.save) && esp_wifi_set_protocol (WIFI_IF_STA, level.protocol) == ESP_OK;
+        DEBUG_PRINTF ("[radio: policy=%s, power=%d, save=%d, protocol=0x%x%s]\n", level.name, (int) level.power, (int) level.save, (unsigned) level.protocol, applied ? "" : " (failed)");
+    }
+    static void connected (const int8_t rssi, const int retries) {
+        _state.rssi = rssi;
+        _state.retries = (uint8_t) retries;
+        int level = 0;
+        while (level + 1 < _level_count && rssi >= _levels [level + 1].rssi)
+            level ++;
+        if (retries > 1 && level > 0)
+            level --;
+        _state.level = (uint8_t) (level > _state.level + 1 ? _state.level + 1 : level);
+    }
+    static void failed () {
+        _state.level = 0;
+        if (_state.failures < 255)
+            _state.failures ++;
+    }
+    static void telemetry (Variables &vars) {
+        const Level &level = _levels [_state.level];
+        vars ["rssi"] = String ((int) _state.rssi);
+        vars ["retries"] = String ((int) _state.retries);
+        vars ["failures"] = String ((int) _state.failures);
+        vars ["radio"] = level.name;
+        vars ["txp"] = String ((int) level.power);
+        vars ["ps"] = String ((int) level.save);
+        vars ["proto"] = String ((unsigned) level.protocol);
+    }
+};
+constexpr RadioPolicy::Level RadioPolicy::_levels [];
+RTC_DATA_ATTR RadioPolicy::State RadioPolicy::_state = { 0, 0, 0, 0 };
+
 // -----------------------------------------------------------------------------------------------
 
 class Network {
@@ -18,11 +83,12 @@ public:
         WiFi.setHostname (host.c_str ());
         WiFi.setAutoReconnect (true);
         WiFi.mode (WIFI_STA);
+        RadioPolicy::apply ();
         WiFi.begin (ssid.c_str (), pass.c_str ());
     }
     ~Network (void) {
         WiFi.mode (WIFI_OFF);
-        delay (100);      
+        sleep_delay (100);      
     }
 
     //
@@ -35,12 +101,14 @@ public:
         while (!WiFi.isConnected ()) {
             if (++ cnt > DEFAULT_NETWORK_CONNECT_RETRY_COUNT) {
                 DEBUG_PRINTF (" failed\n");
+                RadioPolicy::failed ();
                 return false;
             }
             DEBUG_PRINTF (".");
-            delay (DEFAULT_NETWORK_CONNECT_RETRY_DELAY);
+            sleep_delay (DEFAULT_NETWORK_CONNECT_RETRY_DELAY);
         }
-        DEBUG_PRINTF (" succeeded: address=%s\n", WiFi.localIP ().toString ().c_str ());
+        DEBUG_PRINTF (" succeeded: address=%s, rssi=%d\n", WiFi.localIP ().toString ().c_str (), (int) WiFi.RSSI ());
+        RadioPolicy::connected (WiFi.RSSI (), cnt);
         return true;
     }
 
@@ -89,6 +157,7 @@ public:
             }
         } else {
             DEBUG_PRINTF (" failed: network request, error=%s\n", http.errorToString (code).c_str ());
+            RadioPolicy::failed ();
         }
         http.end ();
         return false;
@@ -0,0 +1,377 @@
+
+// -----------------------------------------------------------------------------------------------
+
+#include <esp32-hal-cpu.h>
+#include <esp_sleep.h>
+#include <esp_wifi.h>
+#include <esp_pm.h>
+#include <driver/gpio.h>
+
+// -----------------------------------------------------------------------------------------------
+
+typedef enum {
+    POWER_PROGRAM,
+    POWER_NETWORK,
+    POWER_PARSE,
+    POWER_RENDER,
+    POWER_PANEL,
+    POWER_PANEL_WAIT,
+    POWER_OTA,
+    POWER_COUNT
+} PowerPhase;
+
+class PowerGovernor {
+    struct Profile {
+        const char *name;
+        const uint32_t mhz;
+        const bool radio, panel;
+    };
+    static constexpr Profile _profiles [POWER_COUNT] = {
+        { "program",    DEFAULT_POWER_MHZ_BURST, false, false },
+        { "network",    DEFAULT_POWER_MHZ_RADIO, true,  false },
+        { "parse",      DEFAULT_POWER_MHZ_BURST, true,  false },
+        { "render",     DEFAULT_POWER_MHZ_BURST, false, false },
+        { "panel",      DEFAULT_POWER_MHZ_RADIO, false, true  },
+        { "panel-wait", DEFAULT_POWER_MHZ_WAIT,  false, true  },
+        { "ota",        DEFAULT_POWER_MHZ_RADIO, true,  false },
+    };
+    static PowerPhase _phase, _enclosing;
+    static unsigned long _started, _elapsed [POWER_COUNT], _asleep [POWER_COUNT];
+
+    // estimated supply current (mA), coarse figures from the ESP32 datasheet and Inkplate2 measurements
+    static constexpr float _current_radio = 80.0f, _current_panel = 8.0f, _current_asleep = 1.0f;
+    static float _current (const uint32_t mhz, const bool radio, const bool panel) {
+        return (mhz >= 240 ? 50.0f : mhz >= 160 ? 40.0f : mhz >= 80 ? 25.0f : mhz >= 40 ? 15.0f : 10.0f) + (radio ? _current_radio : 0.0f) + (panel ? _current_panel : 0.0f);
+    }
+    static void _account () {
+        const unsigned long now = millis ();
+        _elapsed [_phase] += now - _started;
+        _started = now;
+    }
+
+public:
+    static PowerPhase phase (const PowerPhase phase) {
+        const PowerPhase previous = _phase;
+        _account ();
+        _phase = phase;
+        if (getCpuFrequencyMhz () != _profiles [phase].mhz)
+            setCpuFrequencyMhz (_profiles [phase].mhz);
+        return previous;
+    }
+    static void asleep (const unsigned long ms) {
+        _asleep [_phase] += ms;
+    }
+    // panel phases nest within whatever phase started the transfer, which is restored once the panel is idle
+    static void panel (const Inkplate::Phase phase) {
+        const bool within = _phase == POWER_PANEL || _phase == POWER_PANEL_WAIT;
+        if (phase == Inkplate::PanelIdle) {
+            if (within)
+                PowerGovernor::phase (_enclosing);
+        } else {
+            const PowerPhase previous = PowerGovernor::phase (phase == Inkplate::PanelWait ? POWER_PANEL_WAIT : POWER_PANEL);
+            if (!within)
+                _enclosing = previous;
+        }
+    }
+    // energy (uAh) used by a phase, as governed or as it would have been at the burst clock
+    static float energy (const PowerPhase phase, const bool governed = true) {
+        const Profile &profile = _profiles [phase];
+        const unsigned long asleep = governed ? (_asleep [phase] < _elapsed [phase] ? _asleep [phase] : _elapsed [phase]) : 0;
+        return (_current (governed ? profile.mhz : DEFAULT_POWER_MHZ_BURST, profile.radio, profile.panel) * (float) (_elapsed [phase] - asleep)
+            + (_current_asleep + (profile.panel ? _current_panel : 0.0f)) * (float) asleep) / 3600.0f;
+    }
+    static float energy (const bool governed = true) {
+        float total = 0.0f;
+        for (int phase = 0; phase < POWER_COUNT; phase ++)
+            total += energy ((PowerPhase) phase, governed);
+        return total;
+    }
+    static void report () {
+        _account ();
+        for (int phase = 0; phase < POWER_COUNT; phase ++)
+            if (_elapsed [phase] > 0)
+                DEBUG_PRINTF ("[power: %s %lums (%lums asleep) @ %luMHz, ~%.1fuAh (~%.1fuAh ungoverned)]\n", _profiles [phase].name, _elapsed [phase], _asleep [phase], (unsigned long) _profiles [phase].mhz, energy ((PowerPhase) phase), energy ((PowerPhase) phase, false));
+        DEBUG_PRINTF ("[power: total ~%.1fuAh (~%.1fuAh ungoverned)]\n", energy (), energy (false));
+    }
+
+    class Scope {
+        const PowerPhase _previous;
+    public:
+        Scope (const PowerPhase phase): _previous (PowerGovernor::phase (phase)) {}
+        ~Scope () { PowerGovernor::phase (_previous); }
+    };
+};
+constexpr PowerGovernor::Profile PowerGovernor::_profiles [POWER_COUNT];
+constexpr float PowerGovernor::_current_radio, PowerGovernor::_current_panel, PowerGovernor::_current_asleep;
+PowerPhase PowerGovernor::_phase = POWER_PROGRAM, PowerGovernor::_enclosing = POWER_PROGRAM;
+unsigned long PowerGovernor::_started = 0, PowerGovernor::_elapsed [POWER_COUNT] = { 0 }, PowerGovernor::_asleep [POWER_COUNT] = { 0 };
+
+// -----------------------------------------------------------------------------------------------
+
+// delay that lets the core sleep: with the radio off, waits above the threshold use light sleep with a timer
+// wakeup; with the radio on, light sleep would drop the association, so use automatic light sleep between
+// beacons where the build supports it (tickless idle), otherwise modem sleep while the idle task waits
+
+void sleep_delay (const uint32_t ms) {
+    if (ms < DEFAULT_POWER_SLEEP_THRESHOLD) {
+        delay (ms);
+        return;
+    }
+    wifi_mode_t mode;
+    if (esp_wifi_get_mode (&mode) != ESP_OK || mode == WIFI_MODE_NULL) {
+#ifdef DEBUG
+        Serial.flush ();
+#endif
+        const unsigned long started = millis ();
+        esp_sleep_enable_timer_wakeup (1000ULL * ms);
+        esp_light_sleep_start ();
+        esp_sleep_disable_wakeup_source (ESP_SLEEP_WAKEUP_TIMER);
+        PowerGovernor::asleep (millis () - started);
+    } else {
+#if defined (CONFIG_PM_ENABLE) && defined (CONFIG_FREERTOS_USE_TICKLESS_IDLE)
+#if ESP_IDF_VERSION_MAJOR >= 5
+        esp_pm_config_t config = { (int) getCpuFrequencyMhz (), (int) getCpuFrequencyMhz (), true };
+#else
+        esp_pm_config_esp32_t config = { (int) getCpuFrequencyMhz (), (int) getCpuFrequencyMhz (), true };
+#endif
+        const bool automatic = esp_pm_configure (&config) == ESP_OK;
+        delay (ms);
+        if (automatic) {
+            config.light_sleep_enable = false;
+            esp_pm_configure (&config);
+        }
+#else
+        delay (ms);
+#endif
+    }
+}
+
+// wait for a pin to reach a level that lets the core sleep: with the radio off, light sleep woken by the
+// pin (a GPIO wakeup on the level) or by a timer at the timeout, so the core draws sleep current until the
+// edge; with the radio on, delays in steps so the idle task can modem sleep
+
+bool sleep_until (const uint8_t pin, const uint8_t level, const uint32_t timeout) {
+    const unsigned long started = millis ();
+    wifi_mode_t mode;
+    if (esp_wifi_get_mode (&mode) != ESP_OK || mode == WIFI_MODE_NULL) {
+#ifdef DEBUG
+        Serial.flush ();
+#endif
+        gpio_wakeup_enable ((gpio_num_t) pin, level ? GPIO_INTR_HIGH_LEVEL : GPIO_INTR_LOW_LEVEL);
+        esp_sleep_enable_gpio_wakeup ();
+        for (unsigned long elapsed; digitalRead (pin) != level && (elapsed = millis () - started) < timeout; ) {
+            const unsigned long slept = millis ();
+            esp_sleep_enable_timer_wakeup (1000ULL * (timeout - elapsed));
+            esp_light_sleep_start ();
+            PowerGovernor::asleep (millis () - slept);
+        }
+        esp_sleep_disable_wakeup_source (ESP_SLEEP_WAKEUP_TIMER);
+        esp_sleep_disable_wakeup_source (ESP_SLEEP_WAKEUP_GPIO);
+        gpio_wakeup_disable ((gpio_num_t) pin);
+    } else {
+        while (digitalRead (pin) != level && millis () - started < timeout)
+            delay (DEFAULT_POWER_SLEEP_THRESHOLD);
+    }
+    return digitalRead (pin) == level;
+}
+
+// -----------------------------------------------------------------------------------------------
+
+// refresh watchdog: each refresh is bounded by DEFAULT_PANEL_REFRESH_TIMEOUT, and its busy time compared
+// with the typical time kept (smoothed) in RTC memory; those that time out, end implausibly soon (BUSY not
+// driven, the panel disconnected) or stray far from typical (a failing panel, the cold) are counted and
+// reported as anomalies
+
+class RefreshWatchdog {
+    struct State {
+        uint32_t refreshes, timeouts, anomalies;
+        uint32_t last, longest; // ms
+        float typical; // ms
+    };
+    static State _state;
+
+public:
+    static uint32_t timeout () {
+        return DEFAULT_PANEL_REFRESH_TIMEOUT;
+    }
+    static void record (const bool completed, const uint32_t ms) {
+        _state.refreshes ++;
+        _state.last = ms;
+        if (_state.last > _state.longest)
+            _state.longest = _state.last;
+        if (!completed) {
+            _state.timeouts ++;
+            DEBUG_PRINTF ("[refresh: timed out after %lums, %lu of %lu]\n", (unsigned long) ms, (unsigned long) _state.timeouts, (unsigned long) _state.refreshes);
+            return;
+        }
+        const bool anomalous = ms < DEFAULT_PANEL_REFRESH_MINIMUM || (_state.typical > 0.0f &&
+            ((float) ms < _state.typical * (1.0f - DEFAULT_PANEL_REFRESH_DEVIATION) || (float) ms > _state.typical * (1.0f + DEFAULT_PANEL_REFRESH_DEVIATION)));
+        if (anomalous)
+            _state.anomalies ++;
+        else
+            _state.typical = _state.typical > 0.0f ? _state.typical + DEFAULT_PANEL_REFRESH_SMOOTHING * ((float) ms - _state.typical) : (float) ms;
+        DEBUG_PRINTF ("[refresh: %lums%s, typical %.0fms, longest %lums, %lu anomalies and %lu timeouts in %lu]\n", (unsigned long) ms, anomalous ? " (anomalous)" : "",
+            _state.typical, (unsigned long) _state.longest, (unsigned long) _state.anomalies, (unsigned long) _state.timeouts, (unsigned long) _state.refreshes);
+    }
+    static void telemetry (Variables &vars) {
+        if (_state.refreshes == 0)
+            return;
+        vars ["refresh"] = String ((unsigned long) _state.last);
+        vars ["refresh_anomalies"] = String ((unsigned long) _state.anomalies);
+        vars ["refresh_timeouts"] = String ((unsigned long) _state.timeouts);
+    }
+};
+RTC_DATA_ATTR RefreshWatchdog::State RefreshWatchdog::_state = { 0, 0, 0, 0, 0, 0.0f };
+
+// -----------------------------------------------------------------------------------------------
+
+// battery governor: reads the cell each wake through an ADC divider and steps down the work done as
+// the charge falls (the Inkplate2 has no battery sense of its own, so DEFAULT_BATTERY_PIN must name
+// the pin the divider is wired to; without one the device is taken as mains powered and not governed)
+
+typedef enum {
+    BATTERY_NORMAL,
+    BATTERY_SAVING,
+    BATTERY_LOW,
+    BATTERY_CRITICAL,
+    BATTERY_COUNT
+} BatteryLevel;
+
+class BatteryGovernor {
+    struct Profile {
+        const char *name;
+        const int charge; // at or above (%)
+        const uint32_t interval, ota; // sleep multiplier, ota counter divisor (0 for none)
+        const bool minor; // skip refresh on minor changes
+    };
+    static constexpr Profile _profiles [BATTERY_COUNT] = {
+        { "normal",   50, 1, 1, false },
+        { "saving",   25, 2, 2, true  },
+        { "low",      10, 4, 4, true  },
+        { "critical", 0,  8, 0, true  },
+    };
+    struct State {
+        uint16_t history [DEFAULT_BATTERY_HISTORY];
+        uint8_t history_count, history_index;
+        float shown [DEFAULT_BATTERY_SHOWN];
+        uint8_t shown_count, shown_skips;
+        uint32_t shown_hash;
+        float energy; // used by last wake (uAh)
+        uint32_t secs; // slept after last wake
+    };
+    static State _state;
+    static BatteryLevel _level;
+    static uint16_t _millivolts;
+    static int _charge;
+
+    static int _discharge (const uint16_t mv) { // single cell LiPo, resting
+        static constexpr uint16_t curve [][2] = { { 4200, 100 }, { 4100, 90 }, { 4000, 80 }, { 3900, 65 }, { 3800, 50 }, { 3750, 40 }, { 3700, 25 }, { 3650, 15 }, { 3600, 10 }, { 3500, 5 }, { 3300, 0 } };
+        if (mv >= curve [0][0])
+            return 100;
+        for (size_t i = 1; i < sizeof (curve) / sizeof (curve [0]); i ++)
+            if (mv >= curve [i][0])
+                return curve [i][1] + (curve [i - 1][1] - curve [i][1]) * (mv - curve [i][0]) / (curve [i - 1][0] - curve [i][0]);
+        return 0;
+    }
+
+public:
+    static bool governed () {
+        return DEFAULT_BATTERY_PIN >= 0;
+    }
+    static void measure () {
+        if (!governed ())
+            return;
+        uint32_t mv = 0;
+        for (int i = 0; i < 4; i ++)
+            mv += analogReadMilliVolts (DEFAULT_BATTERY_PIN);
+        _state.history [_state.history_index] = (uint16_t) ((float) mv / 4.0f * DEFAULT_BATTERY_DIVIDER);
+        _state.history_index = (_state.history_index + 1) % DEFAULT_BATTERY_HISTORY;
+        if (_state.history_count < DEFAULT_BATTERY_HISTORY)
+            _state.history_count ++;
+        uint32_t total = 0;
+        for (int i = 0; i < _state.history_count; i ++)
+            total += _state.history [i];
+        _millivolts = (uint16_t) (total / _state.history_count);
+        _charge = _discharge (_millivolts);
+        int level = BATTERY_NORMAL;
+        while (level + 1 < BATTERY_COUNT && _charge < _profiles [level].charge)
+            level ++;
+        _level = (BatteryLevel) level;
+        DEBUG_PRINTF ("[battery: %umV (%u readings), %d%%, %s, ~%.0fh remaining]\n", (unsigned) _millivolts, (unsigned) _state.history_count, _charge, _profiles [_level].name, runtime ());
+    }
+
+    static long interval (const long secs) {
+        return secs * (long) _profiles [_level].interval;
+    }
+    static uint32_t ota (const uint32_t secs) {
+        return _profiles [_level].ota > 0 ? secs / _profiles [_level].ota : 0;
+    }
+    // refresh unless the values as presented, a line per renderer, have only changed by a little since last
+    // shown (and saving): numeric lines compare within the minor change, the others must be the same
+    static bool refresh (const String &shown) {
+        float values [DEFAULT_BATTERY_SHOWN];
+        int count = 0;
+        uint32_t hash = hash_fnv ("");
+        bool minor = true;
+        for (int start = 0, end; start < (int) shown.length (); start = end + 1) {
+            if ((end = shown.indexOf ('\n', start)) < 0)
+                end = shown.length ();
+            const String line = shown.substring (start, end);
+            char *stop;
+            const float value = strtof (line.c_str (), &stop);
+            while (*stop == ' ')
+                stop ++;
+            if (stop != line.c_str () && *stop == '\0' && count < DEFAULT_BATTERY_SHOWN) {
+                if (count >= _state.shown_count || fabsf (value - _state.shown [count]) >= DEFAULT_BATTERY_MINOR_CHANGE)
+                    minor = false;
+                values [count ++] = value;
+                hash = hash_fnv ("#\n", hash);
+            } else
+                hash = hash_fnv (line + "\n", hash);
+        }
+        if (minor && count == _state.shown_count && hash == _state.shown_hash && _profiles [_level].minor && _state.shown_skips < DEFAULT_BATTERY_MINOR_SKIPS) {
+            _state.shown_skips ++;
+            DEBUG_PRINTF ("[battery: refresh skipped, minor changes (%u in a row)]\n", (unsigned) _state.shown_skips);
+            return false;
+        }
+        memcpy (_state.shown, values, sizeof (float) * count);
+        _state.shown_count = (uint8_t) count;
+        _state.shown_hash = hash;
+        _state.shown_skips = 0;
+        return true;
+    }
+
+    // remaining runtime (hours) from the charge left and the energy used by the last wake and sleep
+    static float runtime () {
+        if (_state.secs == 0)
+            return -1.0f;
+        const float cycle = _state.energy + (float) DEFAULT_BATTERY_SLEEP_CURRENT * (float) _state.secs / 3600.0f;
+        return ((float) DEFAULT_BATTERY_CAPACITY * 1000.0f * (float) _charge / 100.0f) / cycle * (float) _state.secs / 3600.0f;
+    }
+    static void account (const float energy, const uint32_t secs) {
+        _state.energy = energy;
+        _state.secs = secs;
+    }
+    static void variables (Variables &vars) {
+        if (!governed ())
+            return;
+        vars ["device/battery"] = String ((unsigned) _millivolts);
+        vars ["device/charge"] = String (_charge);
+        vars ["device/runtime"] = String ((long) runtime ());
+    }
+    static void telemetry (Variables &vars) {
+        if (!governed ())
+            return;
+        vars ["battery"] = String ((unsigned) _millivolts);
+        vars ["charge"] = String (_charge);
+        vars ["power"] = _profiles [_level].name;
+        vars ["runtime"] = String ((long) runtime ());
+    }
+};
+constexpr BatteryGovernor::Profile BatteryGovernor::_profiles [BATTERY_COUNT];
+RTC_DATA_ATTR BatteryGovernor::State BatteryGovernor::_state = { { 0 }, 0, 0, { 0.0f }, 0, 0, 0, 0.0f, 0 };
+BatteryLevel BatteryGovernor::_level = BATTERY_NORMAL;
+uint16_t BatteryGovernor::_millivolts = 0;
+int BatteryGovernor::_charge = 100;
+
+// -----------------------------------------------------------------------------------------------
@@ -8,6 +8,9 @@
 class Program {
     const Variables &_conf;
     PersistentValue <String> _sets_PERSISTENT;
+#ifdef DEFAULT_SETS_BUILTIN
+    bool _sets_builtin = false;
+#endif
 
 public:
     Program (const Variables &conf): _conf (conf), _sets_PERSISTENT ("program", "sets", "") {}
@@ -18,8 +21,12 @@ public:
     
     long exec (Inkplate &view) {
         Variables sets, vars, varx;
+        const long secs = strtol (_conf.at ("secs").c_str (), NULL, 10);
+        BatteryGovernor::measure ();
         if (setup (_conf, sets) && load (_conf, vars)) {
-            view.begin ();
+            const PowerGovernor::Scope scope (POWER_RENDER);
+            view.begin (DEFAULT_BASE_FRAME);
+            view.setGlyphCache (DEFAULT_GLYPHS, sizeof (DEFAULT_GLYPHS) / sizeof (DEFAULT_GLYPHS [0]));
 #ifdef DEBUG
             for (const auto& pair : sets)
                 DEBUG_PRINTF ("= %s = %s\n", pair.first.c_str (), pair.second.c_str ());
@@ -28,34 +35,49 @@ public:
             if (vars.find ("timestamp") != vars.end ())
                 DEBUG_PRINTF ("produced at %s\n", time_iso (std::atol (vars.at ("timestamp").c_str ())).c_str ()); 
 #endif
-            for (const auto& pair : sets) {
-                const auto search = vars.find (pair.second);
-                if (search != vars.end ())
-                  varx [pair.first] = search->second;
-            }
-            if (show (_conf, varx, view))
-                view.display ();
+            BatteryGovernor::variables (vars);
+            bind (sets, vars, varx);
+            RendererHold::apply (varx);
+            const String presented = shown (varx);
+            if (show (_conf, varx, view) && BatteryGovernor::refresh (presented))
+                display (view);
+            return Scheduler::align (vars, BatteryGovernor::interval (Scheduler::adapt (secs, presented)));
         }
-        return strtol (_conf.at ("secs").c_str (), NULL, 10);
+        return BatteryGovernor::interval (secs);
     }
 
 protected:
   
+    static bool _parse (JsonDocument &json, const std::function <bool (JsonDocument &)>& func) {
+        const PowerGovernor::Scope scope (POWER_PARSE);
+        return func (json);
+    }
     void _fetch (const Variables &conf, const String& link, JsonDocument &json, const std::function <bool (JsonDocument &)>& func) {
+        const PowerGovernor::Scope scope (POWER_NETWORK);
         Network network (conf.at ("host"), conf.at ("ssid"), conf.at ("pass"));
         if (!network.connect ())
             throw std::runtime_error ("network connect failed");
         int cnt = 0;
-        while (!network.request (link, json) || !func (json)) { // XXX
+        while (!network.request (link, json) || !_parse (json, func)) { // XXX
             if (++ cnt > DEFAULT_NETWORK_REQUEST_RETRY_COUNT)
                 throw std::runtime_error ("network request failed");
             DEBUG_PRINTF ("network request retry #%d\n", cnt);
-            delay (DEFAULT_NETWORK_REQUEST_RETRY_DELAY);
+            sleep_delay (DEFAULT_NETWORK_REQUEST_RETRY_DELAY);
         }
         network.disconnect ();
     }
 
+    // sets compiled in for one device (DEFAULT_SETS_BUILTIN) are used only on that device: any other
+    // downloads its own, as without them, and says so in its telemetry
     bool setup (const Variables &conf, Variables& sets) {
+#ifdef DEFAULT_SETS_BUILTIN
+        _sets_builtin = identify () == DEFAULT_SETS_BUILTIN_MAC;
+        if (_sets_builtin) {
+            DEBUG_PRINTF ("sets builtin: %d for %s\n", (int) (sizeof (DEFAULT_SETS_BUILTIN_TABLE) / sizeof (DEFAULT_SETS_BUILTIN_TABLE [0])), DEFAULT_SETS_BUILTIN_MAC);
+            return true;
+        }
+        DEBUG_PRINTF ("sets builtin: for %s, not this device %s, using downloaded\n", DEFAULT_SETS_BUILTIN_MAC, identify ().c_str ());
+#endif
         String sets_persistent = (String) _sets_PERSISTENT;
         JsonDocument json;
         if (sets_persistent.isEmpty ()) {
@@ -68,25 +90,71 @@ protected:
       }
       return convert (sets, json.as <JsonVariant> ());
     }
+    void bind (const Variables &sets, const Variables &vars, Variables &varx) const {
+#ifdef DEFAULT_SETS_BUILTIN
+        if (_sets_builtin) {
+            for (const auto& set : DEFAULT_SETS_BUILTIN_TABLE) {
+                const auto search = vars.find (set.path);
+                if (search != vars.end ())
+                  varx [set.name] = search->second;
+            }
+            return;
+        }
+#endif
+        for (const auto& pair : sets) {
+            const auto search = vars.find (pair.second);
+            if (search != vars.end ())
+              varx [pair.first] = search->second;
+        }
+    }
     
     bool load (const Variables &conf, Variables &vars) {
+        Variables telemetry;
+        telemetry ["mac"] = identify ();
+        RadioPolicy::telemetry (telemetry);
+        BatteryGovernor::telemetry (telemetry);
+        Scheduler::telemetry (telemetry);
+        RefreshWatchdog::telemetry (telemetry);
+#ifdef DEFAULT_SETS_BUILTIN
+        if (!_sets_builtin)
+            telemetry ["sets"] = String ("mismatch ") + DEFAULT_SETS_BUILTIN_MAC;
+#endif
         JsonDocument json;
-        _fetch (conf, conf.at ("link"), json, [&] (JsonDocument& doc) { return convert (vars, json.as <JsonVariant> ()); });
+        _fetch (conf, conf.at ("link") + String ("?") + query (telemetry), json, [&] (JsonDocument& doc) { return convert (vars, json.as <JsonVariant> ()); });
+        Scheduler::fetched (vars);
         return true;
     }
   
-    bool show (const Variables &conf, const Variables &vars, Inkplate &view) const {
-        for (const auto *renderer : renderers_default)
-            renderer->render (view);
-        for (const auto &pair : renderers_byvalue) {
-            const auto search = vars.find (pair.first);
-            if (search != vars.end ())
-              pair.second->render (view, search->second, vars);
-            else
-              pair.second->render (view);
+    String shown (const Variables &vars) const {
+        String str;
+        for (const auto &entry : renderers_byvalue) {
+            const auto search = vars.find (entry.name);
+            str += search != vars.end () ? entry.renderer->present (search->second, vars) + "\n" : String ("\n");
         }
+        return str;
+    }
+    // hash of the frame last displayed (RTC memory): a pixel-identical frame needs no panel refresh; the
+    // frame drawn is retained by the display list, which may since have drawn one that was not displayed
+    static uint64_t _frame;
+    bool display (Inkplate &view) const {
+        const uint64_t frame = view.frameHash ();
+        if (frame == _frame) {
+            DEBUG_PRINTF ("display unchanged: skipped\n");
+            return false;
+        }
+        const bool refreshed = view.display (RefreshWatchdog::timeout ());
+        if (view.refreshMillis () >= 0)
+            RefreshWatchdog::record (refreshed, (uint32_t) view.refreshMillis ());
+        if (!refreshed)
+            return false;
+        _frame = frame;
+        return true;
+    }
+    bool show (const Variables &conf, const Variables &vars, Inkplate &view) const {
+        DisplayList::show (view, vars);
         return true;
     }
 };
+RTC_DATA_ATTR uint64_t Program::_frame = 0;
 
 // -----------------------------------------------------------------------------------------------
@@ -1,44 +1,65 @@
 
 // -----------------------------------------------------------------------------------------------
 
-#include "fonts/FreeSansBold9pt7b.h"
-#include "fonts/Org_01.h"
-#include "icons/icon_home.h"
-#include "icons/icon_lake.h"
-#include "icons/icon_tree.h"
+#include "Fonts.hpp"
+#include "Base.hpp"
+#include "Glyphs.hpp"
+#include "Metrics.hpp"
 
 #include <vector>
 #include <map>
 
 // -----------------------------------------------------------------------------------------------
 
+// text layout from the generated font metrics: widths are sums of advances and extents from a table, so
+// strings known at compile time are measured by the compiler and values at a lookup per character, without
+// walking glyphs (getTextBounds); trailing spaces (as dtostrf pads) are not counted
+
+struct TextLayout {
+    static constexpr int advance (const FontMetrics &font, const char c) {
+        return ((uint8_t) c >= font.first && (uint8_t) c <= font.last) ? font.advance [(uint8_t) c - font.first] : 0;
+    }
+    static constexpr int extent (const FontMetrics &font, const char c) {
+        return ((uint8_t) c >= font.first && (uint8_t) c <= font.last) ? font.extent [(uint8_t) c - font.first] : 0;
+    }
+    static constexpr bool blank (const char *text) {
+        return *text == '\0' || (*text == ' ' && blank (text + 1));
+    }
+    // from the cursor to the cursor after the text
+    static constexpr int width (const FontMetrics &font, const char *text) {
+        return blank (text) ? 0 : advance (font, *text) + width (font, text + 1);
+    }
+    // from the cursor to the right edge of the ink
+    static constexpr int inked (const FontMetrics &font, const char *text) {
+        return blank (text) ? 0 : blank (text + 1) ? extent (font, *text) : advance (font, *text) + inked (font, text + 1);
+    }
+    // from the cursor to the decimal point, or where it would be
+    static constexpr int whole (const FontMetrics &font, const char *text) {
+        return (*text == '.' || blank (text)) ? 0 : advance (font, *text) + whole (font, text + 1);
+    }
+    // cursor offsets to right align the ink within a box, or to put the decimal point at a point
+    static constexpr int right (const FontMetrics &font, const char *text, const int box) {
+        return box - inked (font, text);
+    }
+    static constexpr int decimal (const FontMetrics &font, const char *text, const int point) {
+        return point - whole (font, text);
+    }
+};
+
+// -----------------------------------------------------------------------------------------------
+
 class Renderer {
 public:
     Renderer (const int x, const int y): _x (x), _y (y) {};
     virtual void render (Inkplate &view, const String &value, const Variables &vars) const {};
     virtual void render (Inkplate &view) const {};
+    virtual String present (const String &value, const Variables &vars) const { return value; };
 protected:
     const int _x, _y;
 };
 
 // -----------------------------------------------------------------------------------------------
 
-class Renderer_Bitmap: public Renderer {
-public:
-    Renderer_Bitmap (const int x, const int y, const uint8_t *data, const int ws, const int hs, const int fg, const int bg): Renderer (x, y), _data (data), _ws (ws), _hs (hs), _fg (fg), _bg (bg) {};
-    void render (Inkplate &view, const String &value, const Variables &vars) const {
-        view.drawBitmap (_x, _y, _data, _ws, _hs, _fg, _bg);
-    };
-    void render (Inkplate &view) const {
-        view.drawBitmap (_x, _y, _data, _ws, _hs, _fg, _bg);
-    };
-protected:
-    const uint8_t *_data;
-    const int _ws, _hs, _fg, _bg;
-};
-
-// -----------------------------------------------------------------------------------------------
-
 class Renderer_String: public Renderer {
 public:
     Renderer_String (const int x, const int y, const int fg, const int bg): Renderer (x, y), _fg (fg), _bg (bg) {};
@@ -59,9 +80,15 @@ class Renderer_Faulty: public Renderer {
 public:
     Renderer_Faulty (const int x, const int y, const int ws, const int hs, const int fg, const int bg, const std::vector <String> vars = std::vector <String> ()): Renderer (x, y), _ws (ws), _hs (hs), _fg (fg), _bg (bg), _vars (vars) {};
     void render (Inkplate &view, const String &value, const Variables &vars) const {
-        if (std::any_of (_vars.cbegin (), _vars.cend (), [vars] (const String &s) { return vars.find (s) == vars.end (); }))
+        if (faulty (value, vars))
             render (view);
     };
+    String present (const String &value, const Variables &vars) const {
+        return faulty (value, vars) ? "x" : "";
+    };
+    virtual bool faulty (const String &value, const Variables &vars) const {
+        return std::any_of (_vars.cbegin (), _vars.cend (), [vars] (const String &s) { return vars.find (s) == vars.end (); });
+    };
     void render (Inkplate &view) const {
         // red cross
         view.drawLine (_x, _y, _x + _ws, _y + _hs, _fg);
@@ -81,9 +108,8 @@ protected:
 class Renderer_BatteryLow: public Renderer_Faulty {
 public:
     Renderer_BatteryLow (const int x, const int y, const int ws, const int hs, const int fg, const int bg, const float threshold): Renderer_Faulty (x, y, ws, hs, fg, bg), _threshold (threshold) {};
-    void render (Inkplate &view, const String &value, const Variables &vars) const {
-        if (std::atof (value.c_str ()) < _threshold)
-            Renderer_Faulty::render (view);
+    bool faulty (const String &value, const Variables &vars) const {
+        return std::atof (value.c_str ()) < _threshold;
     };
 protected:
     const float _threshold;
@@ -91,33 +117,35 @@ protected:
 
 // -----------------------------------------------------------------------------------------------
 
+// values are drawn with their decimal points (or where they would be) at a fixed point, that of the widest
+// value expected, so digits stay in columns as values change
+
 class Renderer_StringFloat: public Renderer_String {
 public:
-    Renderer_StringFloat (const int x, const int y, const int fg, const int bg, const int numdigits): Renderer_String (x, y, fg, bg), _numdigits (numdigits) {};
+    Renderer_StringFloat (const int x, const int y, const int fg, const int bg, const int numdigits, const int point): Renderer_String (x, y, fg, bg), _numdigits (numdigits), _point (point) {};
 
-    virtual int make_offset (const float &data) const = 0;
     virtual void render_symbol (Inkplate &view) const = 0;
 
     void render (Inkplate &view, const String& value, const Variables &vars) const {
-        char string [_stringsz]; 
-        const float data = std::atof (value.c_str ());
-        dtostrf (data, - (_stringsz - 1), _numdigits, string);
-        render_string (view, string, make_offset (data));
+        const String string = present (value, vars);
+        render_string (view, string.c_str (), TextLayout::decimal (DEFAULT_METRICS_FreeSansBold9pt7b, string.c_str (), _point));
         render_symbol (view);
     }
+    String present (const String &value, const Variables &vars) const {
+        char string [_stringsz]; 
+        dtostrf (std::atof (value.c_str ()), - (_stringsz - 1), _numdigits, string);
+        return String (string);
+    }
 protected:
-    const int _numdigits;
-    static constexpr int _stringsz = 6, _digitswidth = 10, _minuswidth = 6; // font dependent
+    const int _numdigits, _point;
+    static constexpr int _stringsz = 6, _digitswidth = TextLayout::width (DEFAULT_METRICS_FreeSansBold9pt7b, "0");
 };
 
 // -----------------------------------------------------------------------------------------------
 
 class Renderer_Temperature: public Renderer_StringFloat {
 public:
-    Renderer_Temperature (const int x, const int y, const int fg, const int bg): Renderer_StringFloat (x, y, fg, bg, 1) {};
-    int make_offset (const float &data) const {
-        return (data >= 0 ? _minuswidth : 0) + ((data > -10.0 && data < 10.0) ? _digitswidth : 0);
-    }
+    Renderer_Temperature (const int x, const int y, const int fg, const int bg): Renderer_StringFloat (x, y, fg, bg, 1, TextLayout::width (DEFAULT_METRICS_FreeSansBold9pt7b, "-00")) {};
     void render_symbol (Inkplate &view) const {
         // superscript degree symbol
         const int r = _digitswidth/3, x = view.getCursorX () + 2 + r, y = view.getCursorY () - 10;
@@ -130,10 +158,7 @@ public:
 
 class Renderer_Humidity: public Renderer_StringFloat {
 public:
-    Renderer_Humidity (const int x, const int y, const int fg, const int bg): Renderer_StringFloat (x, y, fg, bg, 0) {};
-    int make_offset (const float &data) const {
-        return (data >= 0 ? _minuswidth : 0) + ((data > -10.0 && data < 10.0) ? _digitswidth : 0) - (data >= 100.0 ? 10 : 0);
-    }
+    Renderer_Humidity (const int x, const int y, const int fg, const int bg): Renderer_StringFloat (x, y, fg, bg, 0, TextLayout::width (DEFAULT_METRICS_FreeSansBold9pt7b, "-00")) {};
     void render_symbol (Inkplate &view) const {
         // superscript percent symbol
         const int d = 2 * (_digitswidth/3), x = view.getCursorX () + 2, y = view.getCursorY () - 6, r = 1;
@@ -148,10 +173,7 @@ public:
 
 class Renderer_Pressure: public Renderer_StringFloat {
 public:
-    Renderer_Pressure (const int x, const int y, const int fg, const int bg): Renderer_StringFloat (x, y, fg, bg, 0) {};
-    int make_offset (const float &data) const {
-        return (data < 1000.0) ? _digitswidth : 0;
-    }
+    Renderer_Pressure (const int x, const int y, const int fg, const int bg): Renderer_StringFloat (x, y, fg, bg, 0, TextLayout::width (DEFAULT_METRICS_FreeSansBold9pt7b, "0000")) {};
     void render_symbol (Inkplate &view) const {
         // superscript 'hpa'
         view.setFont (&Org_01);
@@ -183,26 +205,186 @@ public:
 #define T_OFF_X(x) (X_OFF + I_FRAME_X + T_PRE_X + T_SPC_X [x])
 #define T_OFF_Y(x) (I_OFF_Y (x) + ((I_FRAME_Y - T_SIZ) / 2) + T_SIZ - T_ADJ_Y)
 
+// the static elements (icons) are prebuilt into the base frame, Base.hpp from tools/baseConvert.py
+static_assert (DEFAULT_BASE_I_SIZ == I_SIZ && DEFAULT_BASE_I_OFF_X == I_OFF_X && DEFAULT_BASE_I_OFF_Y0 == I_OFF_Y (0) && DEFAULT_BASE_I_OFF_Y1 == I_OFF_Y (1) && DEFAULT_BASE_I_OFF_Y2 == I_OFF_Y (2),
+    "Base.hpp does not match the layout, rerun tools/baseConvert.py");
+static_assert (sizeof (DEFAULT_BASE_FRAME) == E_INK_WIDTH * E_INK_HEIGHT / 4, "Base.hpp does not match the panel, rerun tools/baseConvert.py");
 const std::vector <Renderer*> renderers_default = {
-    new Renderer_Bitmap (I_OFF_X, I_OFF_Y (0), icon_home, I_SIZ, I_SIZ, INKPLATE2_BLACK, INKPLATE2_WHITE),
-    new Renderer_Bitmap (I_OFF_X, I_OFF_Y (1), icon_tree, I_SIZ, I_SIZ, INKPLATE2_BLACK, INKPLATE2_WHITE),
-    new Renderer_Bitmap (I_OFF_X, I_OFF_Y (2), icon_lake, I_SIZ, I_SIZ, INKPLATE2_BLACK, INKPLATE2_WHITE),
-};
-typedef std::pair <String, Renderer*> RendererPair;
-const std::vector <RendererPair> renderers_byvalue = {
-    { "house/__runtime",    new Renderer_Faulty       (I_OFF_X, I_OFF_Y (0), I_SIZ, I_SIZ, INKPLATE2_RED, INKPLATE2_WHITE, { "house/__checks[0]", "house/__checks[1]", "house/__checks[2]" }) },
-    { "house/temp",         new Renderer_Temperature  (T_OFF_X (0), T_OFF_Y (0), INKPLATE2_BLACK, INKPLATE2_WHITE) },
-    { "house/humidity",     new Renderer_Humidity     (T_OFF_X (1), T_OFF_Y (0), INKPLATE2_BLACK, INKPLATE2_WHITE) },
-    { "house/barom",        new Renderer_Pressure     (T_OFF_X (2), T_OFF_Y (0), INKPLATE2_BLACK, INKPLATE2_WHITE) },
-    { "outside/__runtime",  new Renderer_Faulty       (I_OFF_X, I_OFF_Y (1), I_SIZ, I_SIZ, INKPLATE2_RED, INKPLATE2_WHITE, { "outside/__checks[0]", "outside/__checks[1]", "outside/__checks[2]" }) },
-    { "outside/temp",       new Renderer_Temperature  (T_OFF_X (0), T_OFF_Y (1), INKPLATE2_BLACK, INKPLATE2_WHITE) },
-    { "outside/humidity",   new Renderer_Humidity     (T_OFF_X (1), T_OFF_Y (1), INKPLATE2_BLACK, INKPLATE2_WHITE) },
-    { "outside/barom",      new Renderer_Pressure     (T_OFF_X (2), T_OFF_Y (1), INKPLATE2_BLACK, INKPLATE2_WHITE) },
-    { "outside/__runtime",  new Renderer_Faulty       (I_OFF_X, I_OFF_Y (2), I_SIZ, I_SIZ, INKPLATE2_RED, INKPLATE2_WHITE, { "lake/surface_temp", "lake/submerged_temp" }) },
-    { "lake/surface_temp",  new Renderer_Temperature  (T_OFF_X (0), T_OFF_Y (2), INKPLATE2_BLACK, INKPLATE2_WHITE) }, 
-    { "lake/submerged_temp",new Renderer_Temperature  (T_OFF_X (1), T_OFF_Y (2), INKPLATE2_BLACK, INKPLATE2_WHITE) },
-    { "lake/surface_batt",  new Renderer_BatteryLow   (I_OFF_X, I_OFF_Y (2), I_SIZ, I_SIZ, INKPLATE2_RED, INKPLATE2_WHITE, 1.5) },
-    { "lake/submerged_batt",new Renderer_BatteryLow   (I_OFF_X, I_OFF_Y (2), I_SIZ, I_SIZ, INKPLATE2_RED, INKPLATE2_WHITE, 1.5) },
 };
 
+// change policy per renderer: a new value is only shown once it differs from the value shown by at least
+// the deadband, and the value shown has been up for at least the minimum age (none for { 0, 0 })
+struct RendererPolicy {
+    const float deadband;
+    const uint32_t age; // secs
+};
+#define RP_NONE { 0.0f, 0 }
+struct RendererByValue {
+    const String name;
+    const Renderer *renderer;
+    const RendererPolicy policy;
+};
+const std::vector <RendererByValue> renderers_byvalue = {
+    { "house/__runtime",    new Renderer_Faulty       (I_OFF_X, I_OFF_Y (0), I_SIZ, I_SIZ, INKPLATE2_RED, INKPLATE2_WHITE, { "house/__checks[0]", "house/__checks[1]", "house/__checks[2]" }), RP_NONE },
+    { "house/temp",         new Renderer_Temperature  (T_OFF_X (0), T_OFF_Y (0), INKPLATE2_BLACK, INKPLATE2_WHITE),                                                 { 0.15f, 15*60 } },
+    { "house/humidity",     new Renderer_Humidity     (T_OFF_X (1), T_OFF_Y (0), INKPLATE2_BLACK, INKPLATE2_WHITE),                                                 { 1.5f,  15*60 } },
+    { "house/barom",        new Renderer_Pressure     (T_OFF_X (2), T_OFF_Y (0), INKPLATE2_BLACK, INKPLATE2_WHITE),                                                 { 1.5f,  15*60 } },
+    { "outside/__runtime",  new Renderer_Faulty       (I_OFF_X, I_OFF_Y (1), I_SIZ, I_SIZ, INKPLATE2_RED, INKPLATE2_WHITE, { "outside/__checks[0]", "outside/__checks[1]", "outside/__checks[2]" }), RP_NONE },
+    { "outside/temp",       new Renderer_Temperature  (T_OFF_X (0), T_OFF_Y (1), INKPLATE2_BLACK, INKPLATE2_WHITE),                                                 { 0.15f, 10*60 } },
+    { "outside/humidity",   new Renderer_Humidity     (T_OFF_X (1), T_OFF_Y (1), INKPLATE2_BLACK, INKPLATE2_WHITE),                                                 { 1.5f,  10*60 } },
+    { "outside/barom",      new Renderer_Pressure     (T_OFF_X (2), T_OFF_Y (1), INKPLATE2_BLACK, INKPLATE2_WHITE),                                                 { 1.5f,  15*60 } },
+    { "outside/__runtime",  new Renderer_Faulty       (I_OFF_X, I_OFF_Y (2), I_SIZ, I_SIZ, INKPLATE2_RED, INKPLATE2_WHITE, { "lake/surface_temp", "lake/submerged_temp" }), RP_NONE },
+    { "lake/surface_temp",  new Renderer_Temperature  (T_OFF_X (0), T_OFF_Y (2), INKPLATE2_BLACK, INKPLATE2_WHITE),                                                 { 0.15f, 30*60 } }, 
+    { "lake/submerged_temp",new Renderer_Temperature  (T_OFF_X (1), T_OFF_Y (2), INKPLATE2_BLACK, INKPLATE2_WHITE),                                                 { 0.15f, 30*60 } },
+    { "lake/surface_batt",  new Renderer_BatteryLow   (I_OFF_X, I_OFF_Y (2), I_SIZ, I_SIZ, INKPLATE2_RED, INKPLATE2_WHITE, 1.5),                                    RP_NONE },
+    { "lake/submerged_batt",new Renderer_BatteryLow   (I_OFF_X, I_OFF_Y (2), I_SIZ, I_SIZ, INKPLATE2_RED, INKPLATE2_WHITE, 1.5),                                    RP_NONE },
+};
+
+// -----------------------------------------------------------------------------------------------
+
+#include <sys/time.h>
+
+// values last shown per renderer, kept in RTC memory: held values replace new ones that their policy
+// does not yet allow to be shown, so the frame (and the panel) stays as it was
+
+class RendererHold {
+    struct Shown {
+        float value;
+        uint32_t since;
+        bool valid;
+    };
+    static Shown _shown [DEFAULT_RENDER_RETAINED];
+
+public:
+    static void apply (Variables &vars) {
+        struct timeval tv;
+        gettimeofday (&tv, NULL);
+        const uint32_t now = (uint32_t) tv.tv_sec;
+        for (size_t index = 0; index < renderers_byvalue.size () && index < DEFAULT_RENDER_RETAINED; index ++) {
+            const RendererByValue &entry = renderers_byvalue [index];
+            Shown &shown = _shown [index];
+            const auto search = vars.find (entry.name);
+            char *end;
+            const float value = search != vars.end () ? strtof (search->second.c_str (), &end) : 0.0f;
+            if (search == vars.end () || search->second.isEmpty () || *end != '\0' || (entry.policy.deadband <= 0.0f && entry.policy.age == 0)) {
+                shown.valid = false;
+                continue;
+            }
+            const bool changed = !shown.valid || entry.renderer->present (search->second, vars) != entry.renderer->present (String (shown.value, 3), vars);
+            if (!changed)
+                continue;
+            if (shown.valid && (fabsf (value - shown.value) < entry.policy.deadband || now - shown.since < entry.policy.age)) {
+                DEBUG_PRINTF ("[render: %s held at %.2f (new %.2f, shown %lu secs)]\n", entry.name.c_str (), shown.value, value, (unsigned long) (now - shown.since));
+                vars [entry.name] = String (shown.value, 3);
+            } else
+                shown = { value, now, true };
+        }
+    }
+};
+RTC_DATA_ATTR RendererHold::Shown RendererHold::_shown [DEFAULT_RENDER_RETAINED];
+
+// -----------------------------------------------------------------------------------------------
+
+// retained display list: the frame and, per renderer, a hash of what it presents and the bounds of what it
+// drew are kept in RTC memory across wakes; where renderers' input changed, the damage is taken back from
+// the base frame (which has the icons) and those renderers, with any overlapping the damage, are drawn
+// again clipped to it, and the rest of the frame is kept
+// (the Inkplate2 panel has no partial refresh in tri-colour, so this saves render time, not panel time);
+// the frame is most of RTC slow memory, 5512 bytes, against some 500 bytes for all the other state kept
+// across wakes, and flash would take a 5.5 KB write on every wake
+
+struct DisplayBounds {
+    int16_t x0, y0, x1, y1;
+    bool empty () const { return x0 > x1 || y0 > y1; }
+    bool intersects (const DisplayBounds &b) const { return !empty () && !b.empty () && x0 <= b.x1 && b.x0 <= x1 && y0 <= b.y1 && b.y0 <= y1; }
+    void unite (const DisplayBounds &b) {
+        if (b.empty ()) return;
+        if (empty ()) { *this = b; return; }
+        x0 = x0 < b.x0 ? x0 : b.x0; y0 = y0 < b.y0 ? y0 : b.y0; x1 = x1 > b.x1 ? x1 : b.x1; y1 = y1 > b.y1 ? y1 : b.y1;
+    }
+};
+#define DISPLAY_BOUNDS_EMPTY { 0, 0, -1, -1 }
+
+class DisplayList {
+    static constexpr size_t _frame_size = E_INK_WIDTH * E_INK_HEIGHT / 4;
+    struct Item {
+        uint32_t input;
+        DisplayBounds bounds;
+    };
+    static uint8_t _frame [_frame_size];
+    static Item _items [DEFAULT_RENDER_ITEMS];
+    static uint32_t _signature;
+    static_assert (_frame_size + sizeof (Item) * DEFAULT_RENDER_ITEMS <= DEFAULT_RENDER_RTC, "display list exceeds its RTC memory, reduce DEFAULT_RENDER_ITEMS");
+
+    static uint32_t _input (const size_t index, const Variables &vars) {
+        if (index < renderers_default.size ())
+            return 0;
+        const RendererByValue &entry = renderers_byvalue [index - renderers_default.size ()];
+        const auto search = vars.find (entry.name);
+        return search != vars.end () ? hash_fnv ("=" + entry.renderer->present (search->second, vars)) : hash_fnv ("");
+    }
+    static void _draw (Inkplate &view, const size_t index, const Variables &vars) {
+        if (index < renderers_default.size ())
+            return renderers_default [index]->render (view);
+        const RendererByValue &entry = renderers_byvalue [index - renderers_default.size ()];
+        const auto search = vars.find (entry.name);
+        if (search != vars.end ())
+            entry.renderer->render (view, search->second, vars);
+        else
+            entry.renderer->render (view);
+    }
+    static DisplayBounds _bounds (Inkplate &view, const size_t index, const Variables &vars, const bool measure) {
+        DisplayBounds bounds;
+        view.beginBounds (measure);
+        _draw (view, index, vars);
+        return view.endBounds (&bounds.x0, &bounds.y0, &bounds.x1, &bounds.y1) ? bounds : DisplayBounds DISPLAY_BOUNDS_EMPTY;
+    }
+
+public:
+    static void show (Inkplate &view, const Variables &vars) {
+        static const uint32_t signature = hash_fnv (__DATE__ " " __TIME__);
+        const size_t count = renderers_default.size () + renderers_byvalue.size ();
+        if (count > DEFAULT_RENDER_ITEMS) {
+            for (size_t index = 0; index < count; index ++)
+                _draw (view, index, vars);
+            return;
+        }
+        if (_signature != signature) {
+            for (size_t index = 0; index < count; index ++)
+                _items [index] = { _input (index, vars), _bounds (view, index, vars, false) };
+            DEBUG_PRINTF ("[display list: %u items drawn]\n", (unsigned) count);
+        } else {
+            memcpy (view.DMemory4Bit, _frame, _frame_size);
+            bool changed [DEFAULT_RENDER_ITEMS] = { false };
+            DisplayBounds damage = DISPLAY_BOUNDS_EMPTY;
+            for (size_t index = 0; index < count; index ++) {
+                const uint32_t input = _input (index, vars);
+                if (input != _items [index].input) {
+                    changed [index] = true;
+                    damage.unite (_items [index].bounds);
+                    damage.unite (_items [index].bounds = _bounds (view, index, vars, true));
+                    _items [index].input = input;
+                }
+            }
+            // the changed have their new bounds within the damage, the overlapping keep theirs and are only
+            // drawn again where they cross it, so the damage never grows
+            size_t redrawn = 0;
+            if (!damage.empty ()) {
+                view.pushClip (damage.x0, damage.y0, damage.x1 - damage.x0 + 1, damage.y1 - damage.y0 + 1);
+                view.restoreClip (DEFAULT_BASE_FRAME);
+                for (size_t index = 0; index < count; index ++)
+                    if (changed [index] || _items [index].bounds.intersects (damage))
+                        _draw (view, index, vars), redrawn ++;
+                view.popClip ();
+            }
+            DEBUG_PRINTF ("[display list: %u of %u items drawn, damage (%d,%d)-(%d,%d)]\n", (unsigned) redrawn, (unsigned) count, damage.x0, damage.y0, damage.x1, damage.y1);
+        }
+        memcpy (_frame, view.DMemory4Bit, _frame_size);
+        _signature = signature;
+    }
+};
+RTC_NOINIT_ATTR uint8_t DisplayList::_frame [DisplayList::_frame_size];
+RTC_DATA_ATTR DisplayList::Item DisplayList::_items [DEFAULT_RENDER_ITEMS];
+RTC_DATA_ATTR uint32_t DisplayList::_signature = 0;
+
 // -----------------------------------------------------------------------------------------------
@@ -0,0 +1,111 @@
+
+// -----------------------------------------------------------------------------------------------
+
+#include <sys/time.h>
+
+// -----------------------------------------------------------------------------------------------
+
+// adaptive wake interval: lengthen while the values as presented (i.e. to display precision) stay the
+// same across wakes, snap back to the base interval as soon as they change (state in RTC memory)
+
+class Scheduler {
+    struct State {
+        uint32_t shown;
+        long interval;
+        float slot;
+        int64_t local; // RTC clock at last fetch (usecs)
+        long server; // server timestamp at last fetch (secs)
+        float drift; // server secs per RTC clock sec
+    };
+    static State _state;
+    static unsigned long _fetched;
+
+    static long _bound (const long secs) {
+        return secs < DEFAULT_SCHEDULE_MIN ? DEFAULT_SCHEDULE_MIN : secs > DEFAULT_SCHEDULE_MAX ? DEFAULT_SCHEDULE_MAX : secs;
+    }
+    // fraction of the interval this device wakes at: assigned by the server, else derived from its identity
+    static float _slot (const Variables &vars) {
+        const auto slot = vars.find ("schedule/slot"), slots = vars.find ("schedule/slots");
+        if (slot != vars.end () && slots != vars.end () && slots->second.toInt () > 0)
+            _state.slot = (float) slot->second.toInt () / (float) slots->second.toInt ();
+        else if (_state.slot < 0.0f)
+            _state.slot = (float) (hash_fnv (identify ()) % 1000) / 1000.0f;
+        return _state.slot;
+    }
+
+public:
+    static long adapt (const long base, const String &shown) {
+        const uint32_t hash = hash_fnv (shown);
+        const bool quiet = _state.interval > 0 && hash == _state.shown;
+        const long secs = _bound (quiet ? _state.interval + (_state.interval * DEFAULT_SCHEDULE_GROWTH) / 100 : base);
+        DEBUG_PRINTF ("[schedule: %s, interval %ld -> %ld secs]\n", quiet ? "unchanged" : "changed", _state.interval, secs);
+        _state.shown = hash;
+        _state.interval = secs;
+        return secs;
+    }
+
+    // server hint of the next data update: move the wake to the update nearest the intended interval, a
+    // little after it lands, offset by the device's slot within a window so the fleet does not arrive at
+    // once; without a hint, lock the wake to the slot's phase of the interval on the server clock
+    static void fetched (const Variables &vars) {
+        _fetched = millis ();
+        calibrate (vars);
+    }
+    static long align (const Variables &vars, const long secs) {
+        const auto timestamp = vars.find ("timestamp"), next = vars.find ("schedule/next"), cadence = vars.find ("schedule/cadence");
+        if (timestamp == vars.end () || secs <= 0)
+            return secs;
+        const float slot = _slot (vars);
+        const long now = timestamp->second.toInt () + (long) ((millis () - _fetched) / 1000), maximum = secs > DEFAULT_SCHEDULE_MAX ? secs : DEFAULT_SCHEDULE_MAX;
+        const long period = cadence != vars.end () ? cadence->second.toInt () : 0, until = next != vars.end () ? next->second.toInt () - now + DEFAULT_SCHEDULE_MARGIN : -1;
+        long wake;
+        if (period > 0 && until >= 0) {
+            wake = until + (long) (slot * (float) (period < DEFAULT_SCHEDULE_SLOT_WINDOW ? period : DEFAULT_SCHEDULE_SLOT_WINDOW));
+            if (secs > wake)
+                wake += ((secs - wake + period / 2) / period) * period;
+            while (wake < DEFAULT_SCHEDULE_MIN)
+                wake += period;
+            DEBUG_PRINTF ("[schedule: next update in %ld secs, cadence %ld secs, slot %.3f, interval %ld -> %ld secs]\n", until, period, slot, secs, wake);
+        } else {
+            long phase = (((long) (slot * (float) secs) - (now + secs)) % secs + secs) % secs;
+            if (phase > secs / 2)
+                phase -= secs;
+            wake = secs + phase;
+            if (wake < DEFAULT_SCHEDULE_MIN)
+                wake = DEFAULT_SCHEDULE_MIN;
+            DEBUG_PRINTF ("[schedule: slot %.3f, interval %ld -> %ld secs]\n", slot, secs, wake);
+        }
+        return wake > maximum ? maximum : wake;
+    }
+
+    // drift of the RTC slow clock (which times deep sleep) against the server clock, from the time
+    // between fetches as each measures it, smoothed and kept in RTC memory; sleep is then corrected
+    static void calibrate (const Variables &vars) {
+        const auto timestamp = vars.find ("timestamp");
+        if (timestamp == vars.end ())
+            return;
+        struct timeval tv;
+        gettimeofday (&tv, NULL);
+        const int64_t local = (int64_t) tv.tv_sec * 1000000LL + (int64_t) tv.tv_usec;
+        const long server = timestamp->second.toInt ();
+        if (_state.server > 0 && local > _state.local && server > _state.server) {
+            const float elapsed = (float) (local - _state.local) / 1000000.0f, drift = (float) (server - _state.server) / elapsed;
+            if (elapsed >= DEFAULT_SCHEDULE_DRIFT_ELAPSED && drift > 1.0f - DEFAULT_SCHEDULE_DRIFT_LIMIT && drift < 1.0f + DEFAULT_SCHEDULE_DRIFT_LIMIT)
+                _state.drift += (drift - _state.drift) * DEFAULT_SCHEDULE_DRIFT_SMOOTHING;
+            DEBUG_PRINTF ("[schedule: drift %.4f over %.0f secs, correction %.4f]\n", drift, elapsed, _state.drift);
+        }
+        _state.local = local;
+        _state.server = server;
+    }
+    static uint64_t sleep (const long secs) {
+        return (uint64_t) ((float) secs * 1000000.0f / _state.drift);
+    }
+    static void telemetry (Variables &vars) {
+        vars ["slot"] = String (_state.slot, 3);
+        vars ["drift"] = String (_state.drift, 4);
+    }
+};
+RTC_DATA_ATTR Scheduler::State Scheduler::_state = { 0, 0, -1.0f, 0, 0, 1.0f };
+unsigned long Scheduler::_fetched = 0;
+
+// -----------------------------------------------------------------------------------------------
@@ -24,7 +24,7 @@ static bool __ota_network_connect (const char *ssid, const char *pass, const int
           return false;
       }
       DEBUG_PRINTF (".");
-      delay (retry_delay);
+      sleep_delay (retry_delay);
     }
     DEBUG_PRINTF (" succeeded, address=%s\n", WiFi.localIP ().toString ().c_str ());
     return true;
@@ -6,7 +6,12 @@
 #include "Common.hpp"
 #include "Secrets.hpp"
 #include "Config.hpp"
+#ifdef DEFAULT_SETS_BUILTIN
+#include "Sets.hpp"
+#endif
+#include "Power.hpp"
 #include "Network.hpp"
+#include "Schedule.hpp"
 #include "Render.hpp"
 #include "Program.hpp"
 
@@ -33,6 +38,9 @@ void setup () {
     DEBUG_PRINTF ("\n*** %s V%s-%s (%s) ***\n\n", DEFAULT_CONFIG.at ("name").c_str (), DEFAULT_CONFIG.at ("vers").c_str (), __COMPILE_TIMESTAMP__, DEFAULT_CONFIG.at ("host").c_str ());
 
     Inkplate *view = new Inkplate ();
+    view->setPhaseCallback (PowerGovernor::panel);
+    view->setDelayCallback (sleep_delay);
+    view->setWaitCallback (sleep_until);
     Program *program = new Program (DEFAULT_CONFIG);
     int secs = DEFAULT_RESTART_SECS;
     exception_catcher ([&] () { 
@@ -40,19 +48,22 @@ void setup () {
     });
 
     PersistentValue <uint32_t> ota_counter ("program", "ota", 0);
-    ota_counter += (uint32_t) secs;
+    ota_counter += BatteryGovernor::ota ((uint32_t) secs + (uint32_t) (millis () / 1000));
     DEBUG_PRINTF ("[ota_counter: %lu until %d]\n", (unsigned long) ota_counter, DEFAULT_SOFTWARE_TIME);
-    if (ota_counter >= (uint32_t) DEFAULT_SOFTWARE_TIME) { // not exact, but good enough
+    if (ota_counter >= (uint32_t) DEFAULT_SOFTWARE_TIME) { // sleep is drift corrected, so close enough
         ota_counter = 0;
+        const PowerGovernor::Scope scope (POWER_OTA);
         ota_check_and_update (DEFAULT_CONFIG.at ("ssid"), DEFAULT_CONFIG.at ("pass"), DEFAULT_NETWORK_CONNECT_RETRY_COUNT, DEFAULT_NETWORK_CONNECT_RETRY_DELAY,
           DEFAULT_CONFIG.at ("sw-json"), DEFAULT_CONFIG.at ("sw-type"), DEFAULT_CONFIG.at ("sw-vers"), [&] () { program->reset (); });
     }
 
+    PowerGovernor::report ();
+    BatteryGovernor::account (PowerGovernor::energy (), (uint32_t) secs);
     DEBUG_PRINTF ("[deep sleep: %d secs]\n", secs);
     DEBUG_END ();
 
     if (secs > 0)
-        esp_sleep_enable_timer_wakeup (1000L * 1000L * secs);
+        esp_sleep_enable_timer_wakeup (Scheduler::sleep (secs));
     esp_deep_sleep_start ();
 }
 
@@ -0,0 +1,71 @@
+# -----------
+# Simple python script to
+# create the prebuilt base frame header with the
+# static parts of the layout (the icons), already
+# rotated into the panel's two bitplanes
+#
+# Takes the icons from ./icons and saves the frame to ./Base.hpp
+#
+#   python tools/baseConvert.py [sketch directory]
+#
+# -----------
+
+import os, re, sys
+
+directory = sys.argv[1] if len(sys.argv) > 1 else "."
+
+# panel and layout, as Inkplate2.h and Render.hpp (checked there by static_assert)
+E_INK_WIDTH, E_INK_HEIGHT = 104, 212
+I_SIZ, I_BORDER = 32, 1
+I_FRAME_Y = I_BORDER + I_SIZ + I_BORDER
+X_OFF, Y_OFF = 4, (E_INK_WIDTH - (3 * I_FRAME_Y)) // 2
+I_OFF_X = X_OFF
+I_OFF_Y = [Y_OFF + I_FRAME_Y * n for n in range(3)]
+ICONS = [("home", I_OFF_X, I_OFF_Y[0]), ("tree", I_OFF_X, I_OFF_Y[1]), ("lake", I_OFF_X, I_OFF_Y[2])]
+
+WHITE, BLACK, RED = 0, 1, 2
+PLANE = E_INK_WIDTH * E_INK_HEIGHT // 8
+frame = bytearray([0xFF] * (PLANE * 2))
+
+# as Graphics::writePixel for rotation 1
+def pixel(x, y, colour):
+    if x < 0 or y < 0 or x >= E_INK_HEIGHT or y >= E_INK_WIDTH:
+        return
+    x0, y0 = y, E_INK_HEIGHT - x - 1
+    position, bit = E_INK_WIDTH // 8 * y0 + x0 // 8, 1 << (7 - x0 % 8)
+    frame[position] |= bit
+    frame[PLANE + position] |= bit
+    if colour == BLACK:
+        frame[position] &= ~bit
+    elif colour == RED:
+        frame[PLANE + position] &= ~bit
+
+# as Adafruit_GFX::drawBitmap with foreground and background
+def bitmap(x, y, data, w, h, fg, bg):
+    stride = (w + 7) // 8
+    for j in range(h):
+        for i in range(w):
+            pixel(x + i, y + j, fg if data[j * stride + i // 8] & (0x80 >> (i & 7)) else bg)
+
+for name, x, y in ICONS:
+    with open(os.path.join(directory, "icons", "icon_" + name + ".h")) as f:
+        data = [int(value, 16) for value in re.findall(r"0x[0-9a-fA-F]+", f.read())]
+    bitmap(x, y, data, I_SIZ, I_SIZ, BLACK, WHITE)
+
+with open(os.path.join(directory, "Base.hpp"), "w") as f:
+    print("", file=f)
+    print("// -----------------------------------------------------------------------------------------------", file=f)
+    print("", file=f)
+    print("// generated by tools/baseConvert.py from icons/, do not edit", file=f)
+    print("", file=f)
+    print("#define DEFAULT_BASE_I_SIZ " + str(I_SIZ), file=f)
+    print("#define DEFAULT_BASE_I_OFF_X " + str(I_OFF_X), file=f)
+    for n, offset in enumerate(I_OFF_Y):
+        print("#define DEFAULT_BASE_I_OFF_Y" + str(n) + " " + str(offset), file=f)
+    print("", file=f)
+    print("static const uint8_t DEFAULT_BASE_FRAME [" + str(PLANE * 2) + "] PROGMEM = {", file=f)
+    for offset in range(0, len(frame), 26):
+        print("    " + ",".join("0x%02x" % value for value in frame[offset:offset + 26]) + ",", file=f)
+    print("};", file=f)
+    print("", file=f)
+    print("// -----------------------------------------------------------------------------------------------", file=f)
@@ -0,0 +1,57 @@
+# -----------
+# Simple python script to
+# create the font header with only the glyphs the
+# layout draws, as GFXfont tables (see Render.hpp)
+#
+# Takes the fonts from ./fonts and saves the subsets to ./Fonts.hpp
+#
+#   python tools/fontSubset.py [sketch directory]
+#
+# -----------
+
+import os, re, sys
+
+directory = sys.argv[1] if len(sys.argv) > 1 else "."
+
+# what the renderers print: values as dtostrf pads them, and the pressure units
+FONTS = [("FreeSansBold9pt7b", " -.0123456789"), ("Org_01", "hPa")]
+
+def load(name):
+    with open(os.path.join(directory, "fonts", name + ".h")) as f:
+        text = f.read()
+    bitmap = [int(value, 16) for value in re.findall(r"0x[0-9a-fA-F]+", re.search(r"Bitmaps\[\][^{]*{([^}]*)}", text).group(1))]
+    glyphs = [[int(value) for value in entry] for entry in re.findall(r"{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+)\s*}", text)]
+    first, last, yadvance = [int(value, 0) for value in re.search(r"(0x[0-9a-fA-F]+),\s*(0x[0-9a-fA-F]+),\s*(\d+)\s*};", text).groups()]
+    return bitmap, glyphs, first, last, yadvance
+
+with open(os.path.join(directory, "Fonts.hpp"), "w") as f:
+    print("", file=f)
+    print("// -----------------------------------------------------------------------------------------------", file=f)
+    print("", file=f)
+    print("// generated by tools/fontSubset.py from fonts/, do not edit", file=f)
+    print("", file=f)
+    for name, characters in FONTS:
+        bitmap, glyphs, first, last, yadvance = load(name)
+        # contiguous from the lowest to the highest character, as GFXfont needs, those not drawn left empty
+        low, high = min(ord(c) for c in characters), max(ord(c) for c in characters)
+        subset, data = [], []
+        for code in range(low, high + 1):
+            offset, w, h, advance, xo, yo = glyphs[code - first]
+            if chr(code) not in characters:
+                subset.append((0, 0, 0, 0, 0, 0, None))
+                continue
+            subset.append((len(data), w, h, advance, xo, yo, chr(code)))
+            data += bitmap[offset:offset + (w * h + 7) // 8]
+        print("const uint8_t " + name + "Bitmaps [" + str(max(len(data), 1)) + "] PROGMEM = {", file=f)
+        for index in range(0, len(data), 16):
+            print("    " + ",".join("0x%02X" % value for value in data[index:index + 16]) + ",", file=f)
+        if not data:
+            print("    0x00,", file=f)
+        print("};", file=f)
+        print("const GFXglyph " + name + "Glyphs [" + str(len(subset)) + "] PROGMEM = {", file=f)
+        for code, (offset, w, h, advance, xo, yo, c) in enumerate(subset, low):
+            print("    { %5d, %3d, %3d, %3d, %4d, %4d }, // 0x%02X" % (offset, w, h, advance, xo, yo, code) + (" '" + c + "'" if c else ""), file=f)
+        print("};", file=f)
+        print("const GFXfont " + name + " PROGMEM = { (uint8_t *) " + name + "Bitmaps, (GFXglyph *) " + name + "Glyphs, 0x%02X, 0x%02X, %d };" % (low, high, yadvance), file=f)
+        print("", file=f)
+    print("// -----------------------------------------------------------------------------------------------", file=f)
@@ -0,0 +1,83 @@
+# -----------
+# Simple python script to
+# create the glyph cache header with the glyphs
+# the values are drawn with, already rotated into
+# the panel's native orientation (see GlyphCache)
+#
+# Takes the fonts from ./fonts and saves the cache to ./Glyphs.hpp
+#
+#   python tools/glyphConvert.py [sketch directory]
+#
+# -----------
+
+import os, re, sys
+
+directory = sys.argv[1] if len(sys.argv) > 1 else "."
+
+# panel and rotation, as Inkplate2.h and Inkplate::begin
+E_INK_WIDTH, E_INK_HEIGHT, ROTATION = 104, 212, 1
+FONTS = [("FreeSansBold9pt7b", "-.0123456789"), ("Org_01", "hPa")]
+
+# as Panel<W, H, P, R>::physicalX/Y
+def physical(x, y):
+    W, H = E_INK_WIDTH, E_INK_HEIGHT
+    return [(W - 1 - x, H - 1 - y), (y, H - 1 - x), (x, y), (W - 1 - y, x)][ROTATION]
+
+def load(name):
+    with open(os.path.join(directory, "fonts", name + ".h")) as f:
+        text = f.read()
+    bitmap = [int(value, 16) for value in re.findall(r"0x[0-9a-fA-F]+", re.search(r"Bitmaps\[\][^{]*{([^}]*)}", text).group(1))]
+    glyphs = [[int(value) for value in entry] for entry in re.findall(r"{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+)\s*}", text)]
+    first, last = [int(value, 16) for value in re.search(r"(0x[0-9a-fA-F]+),\s*(0x[0-9a-fA-F]+),\s*\d+\s*};", text).groups()]
+    return bitmap, glyphs, first, last
+
+# as Graphics::writeGlyphPanel: the glyph's physical rows, MSB first, padded to whole bytes
+def rotate(bitmap, offset, w, h):
+    corners = [physical(0, 0), physical(w - 1, h - 1)]
+    px0, py0 = min(x for x, _ in corners), min(y for _, y in corners)
+    pw, ph = abs(corners[0][0] - corners[1][0]) + 1, abs(corners[0][1] - corners[1][1]) + 1
+    stride = (pw + 7) // 8
+    rows = bytearray(stride * ph)
+    for yy in range(h):
+        for xx in range(w):
+            bit = yy * w + xx
+            if bitmap[offset + bit // 8] & (0x80 >> (bit & 7)):
+                x, y = physical(xx, yy)
+                x, y = x - px0, y - py0
+                rows[stride * y + x // 8] |= 0x80 >> (x & 7)
+    return rows
+
+with open(os.path.join(directory, "Glyphs.hpp"), "w") as f:
+    print("", file=f)
+    print("// -----------------------------------------------------------------------------------------------", file=f)
+    print("", file=f)
+    print("// generated by tools/glyphConvert.py from fonts/, do not edit", file=f)
+    print("", file=f)
+    caches = []
+    for name, characters in FONTS:
+        bitmap, glyphs, first, last = load(name)
+        low, high = min(ord(c) for c in characters), max(ord(c) for c in characters)
+        offsets, data = [], bytearray()
+        for code in range(low, high + 1):
+            offset, w, h = glyphs[code - first][0:3]
+            if chr(code) not in characters or w == 0 or h == 0:
+                offsets.append("GLYPH_UNCACHED")
+                continue
+            offsets.append(str(len(data)))
+            data += rotate(bitmap, offset, w, h)
+        print("static const uint16_t DEFAULT_GLYPHS_" + name + "_OFFSETS [" + str(len(offsets)) + "] PROGMEM = {", file=f)
+        for index in range(0, len(offsets), 8):
+            print("    " + ",".join(offsets[index:index + 8]) + ",", file=f)
+        print("};", file=f)
+        print("static const uint8_t DEFAULT_GLYPHS_" + name + "_BITMAP [" + str(len(data)) + "] PROGMEM = {", file=f)
+        for index in range(0, len(data), 26):
+            print("    " + ",".join("0x%02x" % value for value in data[index:index + 26]) + ",", file=f)
+        print("};", file=f)
+        print("", file=f)
+        caches.append("    { &" + name + ", " + str(ROTATION) + ", 0x%02X, 0x%02X, DEFAULT_GLYPHS_" % (low, high) + name + "_OFFSETS, DEFAULT_GLYPHS_" + name + "_BITMAP },")
+    print("static const GlyphCache DEFAULT_GLYPHS [" + str(len(caches)) + "] = {", file=f)
+    for cache in caches:
+        print(cache, file=f)
+    print("};", file=f)
+    print("", file=f)
+    print("// -----------------------------------------------------------------------------------------------", file=f)
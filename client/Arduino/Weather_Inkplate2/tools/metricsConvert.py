@@ -0,0 +1,49 @@
+# -----------
+# Simple python script to
+# create the font metrics header with the advance
+# and ink extent of every glyph, as constexpr tables
+# for text layout without measuring (see TextLayout)
+#
+# Takes the fonts from ./fonts and saves the metrics to ./Metrics.hpp
+#
+#   python tools/metricsConvert.py [sketch directory]
+#
+# -----------
+
+import os, re, sys
+
+directory = sys.argv[1] if len(sys.argv) > 1 else "."
+
+FONTS = ["FreeSansBold9pt7b", "Org_01"]
+
+def load(name):
+    with open(os.path.join(directory, "fonts", name + ".h")) as f:
+        text = f.read()
+    glyphs = [[int(value) for value in entry] for entry in re.findall(r"{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+)\s*}", text)]
+    first, last, yadvance = [int(value, 0) for value in re.search(r"(0x[0-9a-fA-F]+),\s*(0x[0-9a-fA-F]+),\s*(\d+)\s*};", text).groups()]
+    return glyphs, first, last, yadvance
+
+def table(f, kind, name, values):
+    print("static constexpr " + kind + " " + name + " [" + str(len(values)) + "] = {", file=f)
+    for index in range(0, len(values), 16):
+        print("    " + ",".join(str(value) for value in values[index:index + 16]) + ",", file=f)
+    print("};", file=f)
+
+with open(os.path.join(directory, "Metrics.hpp"), "w") as f:
+    print("", file=f)
+    print("// -----------------------------------------------------------------------------------------------", file=f)
+    print("", file=f)
+    print("// generated by tools/metricsConvert.py from fonts/, do not edit", file=f)
+    print("", file=f)
+    print("// per character from first to last: the cursor advance, and the right edge of the ink from the cursor", file=f)
+    print("struct FontMetrics { uint8_t first, last, yAdvance; const uint8_t *advance; const int8_t *extent; };", file=f)
+    print("", file=f)
+    for name in FONTS:
+        glyphs, first, last, yadvance = load(name)
+        # glyphs are { bitmapOffset, width, height, xAdvance, xOffset, yOffset }
+        table(f, "uint8_t", "DEFAULT_METRICS_" + name + "_ADVANCE", [glyph[3] for glyph in glyphs])
+        table(f, "int8_t", "DEFAULT_METRICS_" + name + "_EXTENT", [glyph[4] + glyph[1] if glyph[1] > 0 else 0 for glyph in glyphs])
+        print("static constexpr FontMetrics DEFAULT_METRICS_" + name + " = { 0x%02X, 0x%02X, %d, " % (first, last, yadvance) +
+              "DEFAULT_METRICS_" + name + "_ADVANCE, DEFAULT_METRICS_" + name + "_EXTENT };", file=f)
+        print("", file=f)
+    print("// -----------------------------------------------------------------------------------------------", file=f)
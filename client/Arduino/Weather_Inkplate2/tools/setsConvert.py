@@ -0,0 +1,53 @@
+# -----------
+# Simple python script to
+# create the builtin sets header for fixed
+# installations (see DEFAULT_SETS_BUILTIN)
+#
+# Takes the entry for MAC from client.json and saves it to ./Sets.hpp,
+# which is not committed (it is for one device)
+#
+#   python tools/setsConvert.py <sketch directory> <client.json> <MAC>
+#   python tools/setsConvert.py . ../../../server/http/client.json 0123456789AB
+#
+# -----------
+
+import json, os, sys
+
+if len(sys.argv) != 4:
+    sys.exit("usage: setsConvert.py <sketch directory> <client.json> <MAC>")
+
+directory, filename, mac = sys.argv[1], sys.argv[2], sys.argv[3].upper()
+with open(filename) as f:
+    clients = json.load(f)
+if mac not in clients:
+    sys.exit("setsConvert.py: no client for " + mac + " in " + filename)
+
+# flatten in the same way as convert () in Common.hpp
+sets = []
+def flatten(json, path):
+    if isinstance(json, dict):
+        for key, value in json.items():
+            flatten(value, key if not path else path + "/" + key)
+    elif isinstance(json, list):
+        for index, value in enumerate(json):
+            flatten(value, path + "[" + str(index) + "]")
+    else:
+        sets.append((path, str(json)))
+flatten(clients[mac], "")
+
+with open(os.path.join(directory, "Sets.hpp"), "w") as f:
+    print("", file=f)
+    print("// -----------------------------------------------------------------------------------------------", file=f)
+    print("", file=f)
+    print("// generated by tools/setsConvert.py from client.json, do not edit", file=f)
+    print("", file=f)
+    print("#define DEFAULT_SETS_BUILTIN_MAC \"" + mac + "\"", file=f)
+    print("", file=f)
+    print("struct SetBuiltin { const char *name, *path; };", file=f)
+    print("static constexpr SetBuiltin DEFAULT_SETS_BUILTIN_TABLE [] = {", file=f)
+    width = max(len(name) for name, _ in sets) + 3
+    for name, path in sets:
+        print("    { " + (json.dumps(name) + ",").ljust(width) + json.dumps(path) + " },", file=f)
+    print("};", file=f)
+    print("", file=f)
+    print("// -----------------------------------------------------------------------------------------------", file=f)
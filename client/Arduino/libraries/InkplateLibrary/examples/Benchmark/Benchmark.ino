@@ -0,0 +1,78 @@
+// -----------
+// Fill benchmark: per-pixel drawPixel loops against the span fills (fillRect, fast lines, fillScreen),
+// reported in pixels per second over Serial; then the integer shape primitives against the float
+// versions they replaced (Legacy.h). Only the framebuffer is touched, the panel is not refreshed.
+// -----------
+
+#include "Inkplate.h"
+#include "Legacy.h"
+
+Inkplate display;
+
+static void fillPixels(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c)
+{
+    for (int16_t j = 0; j < h; j++)
+        for (int16_t i = 0; i < w; i++)
+            display.drawPixel(x + i, y + j, c);
+}
+
+static void measure(const char *name, int16_t w, int16_t h)
+{
+    const int n = 200;
+    uint32_t t0 = micros();
+    for (int i = 0; i < n; i++)
+        fillPixels(0, 0, w, h, i % 3);
+    uint32_t t1 = micros();
+    for (int i = 0; i < n; i++)
+        display.fillRect(0, 0, w, h, i % 3);
+    uint32_t t2 = micros();
+    const float pixels = (float)n * w * h;
+    Serial.printf("%-8s %3dx%-3d  pixel %9.0f px/s  span %11.0f px/s  x%.1f\n", name, w, h,
+                  pixels * 1e6f / (t1 - t0), pixels * 1e6f / (t2 - t1), (float)(t1 - t0) / (t2 - t1));
+}
+
+template <typename F> static float timed(F f)
+{
+    const int n = 200;
+    uint32_t t0 = micros();
+    for (int i = 0; i < n; i++)
+        f();
+    return (float)(micros() - t0) / n;
+}
+
+static void shapes()
+{
+    display.setRotation(1);
+    Serial.printf("ellipse     float %7.1f us  integer %7.1f us\n",
+                  timed([] { legacy_drawElipse(display, 90, 45, 106, 52, 1); }),
+                  timed([] { display.drawElipse(90, 45, 106, 52, 1); }));
+    Serial.printf("fill ellipse pixel %7.1f us  spans %7.1f us\n",
+                  timed([] { legacy_fillElipse(display, 90, 45, 106, 52, 1); }),
+                  timed([] { display.fillElipse(90, 45, 106, 52, 1); }));
+    Serial.printf("thick line  float %7.1f us  integer %7.1f us\n",
+                  timed([] { legacy_drawThickLine(display, 10, 90, 200, 12, 1, 5.0f); }),
+                  timed([] { display.drawThickLine(10, 90, 200, 12, 1, 5.0f); }));
+    Serial.printf("gradient    float %7.1f us  integer %7.1f us\n",
+                  timed([] { legacy_drawGradientLine(display, 10, 90, 200, 12, 0, 3, 3.0f); }),
+                  timed([] { display.drawGradientLine(10, 90, 200, 12, 0, 3, 3.0f); }));
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    display.begin();
+    for (int r = 0; r < 4; r++)
+    {
+        display.setRotation(r);
+        Serial.printf("rotation %d\n", r);
+        measure("screen", display.width(), display.height());
+        measure("rect", 40, 24);
+        measure("hline", display.width(), 1);
+        measure("vline", 1, display.height());
+    }
+    shapes();
+}
+
+void loop()
+{
+}
@@ -17,6 +17,10 @@ void Graphics::setRotation(uint8_t x)
         _height = WIDTH;
         break;
     }
+    clipX0 = clipY0 = 0;
+    clipX1 = _width - 1;
+    clipY1 = _height - 1;
+    clipDepth = 0;
 }
 
 uint8_t Graphics::getRotation()
@@ -24,6 +28,132 @@ uint8_t Graphics::getRotation()
     return rotation;
 }
 
+// restrict drawing to the intersection of the current clip and x, y, w, h until the matching popClip;
+// every primitive rejects or narrows against the clip once, so work outside it costs nothing
+void Graphics::pushClip(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    if (clipDepth++ >= GRAPHICS_CLIP_DEPTH)
+        return;
+    int16_t *_saved = clipStack[clipDepth - 1];
+    _saved[0] = clipX0;
+    _saved[1] = clipY0;
+    _saved[2] = clipX1;
+    _saved[3] = clipY1;
+    if (x > clipX0)
+        clipX0 = x;
+    if (y > clipY0)
+        clipY0 = y;
+    if (x + w - 1 < clipX1)
+        clipX1 = x + w - 1;
+    if (y + h - 1 < clipY1)
+        clipY1 = y + h - 1;
+}
+
+void Graphics::popClip()
+{
+    if (clipDepth == 0 || --clipDepth >= GRAPHICS_CLIP_DEPTH)
+        return;
+    const int16_t *_saved = clipStack[clipDepth];
+    clipX0 = _saved[0];
+    clipY0 = _saved[1];
+    clipX1 = _saved[2];
+    clipY1 = _saved[3];
+}
+
+// true when nothing of the inclusive rectangle x0, y0, x1, y1 is within the clip (or the clip is empty)
+bool Graphics::clipRejects(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+    return clipX0 > clipX1 || clipY0 > clipY1 || x1 < clipX0 || x0 > clipX1 || y1 < clipY0 || y0 > clipY1;
+}
+
+// the first and last rows of the clip, inclusive
+void Graphics::clipRows(int16_t *y0, int16_t *y1)
+{
+    *y0 = clipY0;
+    *y1 = clipY1;
+}
+
+// Adafruit_GFX primitives that are not virtual are rejected by their bounding box before being drawn
+void Graphics::drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+{
+    if (!clipRejects(x0 - r, y0 - r, x0 + r, y0 + r))
+        Adafruit_GFX::drawCircle(x0, y0, r, color);
+}
+
+void Graphics::fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+{
+    if (!clipRejects(x0 - r, y0 - r, x0 + r, y0 + r))
+        Adafruit_GFX::fillCircle(x0, y0, r, color);
+}
+
+// its sides are drawn at x and x + w - 1 (and y and y + h - 1) even when w or h is zero or negative
+void Graphics::drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color)
+{
+    const int16_t x1 = x + w - 1, y1 = y + h - 1;
+    if (!clipRejects(x < x1 ? x : x1, y < y1 ? y : y1, x < x1 ? x1 : x, y < y1 ? y1 : y))
+        Adafruit_GFX::drawRoundRect(x, y, w, h, r, color);
+}
+
+void Graphics::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color)
+{
+    if (!clipRejects(x, y, x + w - 1, y + h - 1))
+        Adafruit_GFX::fillRoundRect(x, y, w, h, r, color);
+}
+
+static inline int16_t min3(int16_t a, int16_t b, int16_t c)
+{
+    return a < b ? (a < c ? a : c) : (b < c ? b : c);
+}
+
+static inline int16_t max3(int16_t a, int16_t b, int16_t c)
+{
+    return a > b ? (a > c ? a : c) : (b > c ? b : c);
+}
+
+void Graphics::drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color)
+{
+    if (!clipRejects(min3(x0, x1, x2), min3(y0, y1, y2), max3(x0, x1, x2), max3(y0, y1, y2)))
+        Adafruit_GFX::drawTriangle(x0, y0, x1, y1, x2, y2, color);
+}
+
+void Graphics::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color)
+{
+    if (!clipRejects(min3(x0, x1, x2), min3(y0, y1, y2), max3(x0, x1, x2), max3(y0, y1, y2)))
+        Adafruit_GFX::fillTriangle(x0, y0, x1, y1, x2, y2, color);
+}
+
+void Graphics::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color)
+{
+    if (!clipRejects(x, y, x + w - 1, y + h - 1))
+        Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color);
+}
+
+void Graphics::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color,
+                          uint16_t bg)
+{
+    if (!clipRejects(x, y, x + w - 1, y + h - 1))
+        Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color, bg);
+}
+
+// track the bounds (in rotated coordinates) of the pixels drawn, and optionally only measure them
+void Graphics::beginBounds(bool _measure)
+{
+    bounding = true;
+    measuring = _measure;
+    boundsX0 = boundsY0 = INT16_MAX;
+    boundsX1 = boundsY1 = INT16_MIN;
+}
+
+bool Graphics::endBounds(int16_t *x0, int16_t *y0, int16_t *x1, int16_t *y1)
+{
+    bounding = measuring = false;
+    *x0 = boundsX0;
+    *y0 = boundsY0;
+    *x1 = boundsX1;
+    *y1 = boundsY1;
+    return boundsX0 <= boundsX1;
+}
+
 void Graphics::drawPixel(int16_t x0, int16_t y0, uint16_t color)
 {
     writePixel(x0, y0, color); // Specified in boards folder
@@ -33,27 +163,49 @@ void Graphics::startWrite()
 {
 }
 
+void Graphics::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+    writeSpan(x, y, 1, h, color);
+}
+
+void Graphics::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+    writeSpan(x, y, w, 1, color);
+}
+
+void Graphics::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    writeSpan(x, y, w, h, color);
+}
+
+void Graphics::fillScreen(uint16_t color)
+{
+    writeSpan(0, 0, width(), height(), color);
+}
+
 void Graphics::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
 {
-    for (int i = 0; i < h; ++i)
-        for (int j = 0; j < w; ++j)
-            writePixel(x + j, y + i, color);
+    writeSpan(x, y, w, h, color);
 }
 
 void Graphics::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
 {
-    for (int i = 0; i < h; ++i)
-        writePixel(x, y + i, color);
+    writeSpan(x, y, 1, h, color);
 }
 
 void Graphics::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
 {
-    for (int j = 0; j < w; ++j)
-        writePixel(x + j, y, color);
+    writeSpan(x, y, w, 1, color);
 }
 
+// lines wholly to one side of the clip are rejected before stepping, the rest stop at the clip's far edge
+// and are clipped per pixel before it
 void Graphics::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
 {
+    if ((x0 < clipX0 && x1 < clipX0) || (x0 > clipX1 && x1 > clipX1) || (y0 < clipY0 && y1 < clipY0) ||
+        (y0 > clipY1 && y1 > clipY1))
+        return;
+
     int16_t steep = abs(y1 - y0) > abs(x1 - x0);
     if (steep)
     {
@@ -79,6 +231,10 @@ void Graphics::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_
     else
         ystep = -1;
 
+    const int16_t _last = steep ? clipY1 : clipX1;
+    if (x1 > _last)
+        x1 = _last;
+
     for (; x0 <= x1; x0++)
     {
         if (steep)
@@ -98,6 +254,46 @@ void Graphics::endWrite()
 {
 }
 
+// custom fonts at size 1 go a glyph at a time through writeGlyph, everything else as Adafruit_GFX::write
+size_t Graphics::write(uint8_t c)
+{
+    if (!gfxFont || textsize_x != 1 || textsize_y != 1)
+        return Adafruit_GFX::write(c);
+
+    if (c == '\n')
+    {
+        cursor_x = 0;
+        cursor_y += (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
+    }
+    else if (c != '\r')
+    {
+        uint8_t first = pgm_read_byte(&gfxFont->first);
+        if (c >= first && c <= (uint8_t)pgm_read_byte(&gfxFont->last))
+        {
+            GFXglyph *glyph = gfxFont->glyph + (c - first);
+            uint8_t w = pgm_read_byte(&glyph->width), h = pgm_read_byte(&glyph->height);
+            if (w > 0 && h > 0)
+            {
+                int16_t xo = (int8_t)pgm_read_byte(&glyph->xOffset);
+                if (wrap && (cursor_x + xo + w) > _width)
+                {
+                    cursor_x = 0;
+                    cursor_y += (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
+                }
+                writeGlyph(cursor_x, cursor_y, c, textcolor);
+            }
+            cursor_x += (uint8_t)pgm_read_byte(&glyph->xAdvance);
+        }
+    }
+    return 1;
+}
+
+void Graphics::setGlyphCache(const GlyphCache *caches, uint8_t count)
+{
+    glyphCaches = caches;
+    glyphCacheCount = count;
+}
+
 int16_t Graphics::width()
 {
     return _width;
@@ -7,6 +7,26 @@
 #include "Image.h"
 #include "Shapes.h"
 
+/**
+ * @brief       Glyphs of a GFX font already rotated into the panel's native orientation: for each
+ * character from first to last an offset into bitmap, or GLYPH_UNCACHED, with the glyph stored as its
+ * physical rows, each packed MSB first in whole bytes (as Graphics::writeGlyph would rotate it)
+ */
+#define GLYPH_UNCACHED 0xFFFF
+typedef struct
+{
+    const GFXfont *font;
+    uint8_t rotation;
+    uint8_t first, last;
+    const uint16_t *offsets;
+    const uint8_t *bitmap;
+} GlyphCache;
+
+/**
+ * @brief       Depth of the clip stack: pushes beyond it are counted (so pops still pair) but do not clip
+ */
+#define GRAPHICS_CLIP_DEPTH 8
+
 /**
  * @brief       Graphics class that holds basic functionalities for Inkplate
  * display
@@ -14,23 +34,69 @@
 class Graphics : public Shapes, public Image
 {
   public:
-    Graphics(int16_t w, int16_t h) : Adafruit_GFX(w, h), Shapes(w, h), Image(w, h){};
+    Graphics(int16_t w, int16_t h) : Adafruit_GFX(w, h), Shapes(w, h), Image(w, h), clipX1(w - 1), clipY1(h - 1){};
 
     void setRotation(uint8_t r);
     uint8_t getRotation();
 
     void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    void fillScreen(uint16_t color) override;
+
+    size_t write(uint8_t c) override;
+    void setGlyphCache(const GlyphCache *caches, uint8_t count);
 
     int16_t width() override;
     int16_t height() override;
 
+    void pushClip(int16_t x, int16_t y, int16_t w, int16_t h);
+    void popClip();
+
+    void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+    void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+    void drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color);
+    void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color);
+    void drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+    void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+    using Adafruit_GFX::drawBitmap;
+    void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color);
+    void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg);
+
+    void beginBounds(bool _measure = false);
+    bool endBounds(int16_t *x0, int16_t *y0, int16_t *x1, int16_t *y1);
+
     uint8_t *DMemory4Bit;
 
     const uint8_t pixelMaskLUT[8] = {0x1, 0x2, 0x4, 0x8, 0x10, 0x20, 0x40, 0x80};
 
+  protected:
+    bool bounding = false, measuring = false;
+    int16_t boundsX0, boundsY0, boundsX1, boundsY1;
+    void includeBounds(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
+    // the current clip, inclusive and always within the screen (empty when x0 > x1), and those it replaced
+    int16_t clipX0 = 0, clipY0 = 0, clipX1, clipY1;
+    int16_t clipStack[GRAPHICS_CLIP_DEPTH][4];
+    uint8_t clipDepth = 0;
+    bool clipRejects(int16_t x0, int16_t y0, int16_t x1, int16_t y1) override;
+    void clipRows(int16_t *y0, int16_t *y1) override;
+
   private:
+
+    const GlyphCache *glyphCaches = NULL;
+    uint8_t glyphCacheCount = 0;
+
     void startWrite(void) override;
     void writePixel(int16_t x, int16_t y, uint16_t color) override;
+    void writeSpan(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    template <typename P> void writePixelPanel(int16_t x, int16_t y, uint16_t color);
+    template <typename P> void writeSpanPanel(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void writeGlyph(int16_t x, int16_t y, uint8_t c, uint16_t color);
+    template <typename P>
+    void writeGlyphPanel(int16_t x, int16_t y, int16_t w, int16_t h, const uint8_t *bitmap, const uint8_t *rows,
+                         uint16_t color);
     void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
     void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
     void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
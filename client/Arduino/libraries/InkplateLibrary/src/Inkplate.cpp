@@ -8,3 +8,44 @@ void Inkplate::clearDisplay() {
     memset (DMemory4Bit, 0xFF, E_INK_WIDTH * E_INK_HEIGHT / 4);
 }
 
+uint64_t Inkplate::frameHash() {
+    // FNV-1a over both bitplanes
+    uint64_t hash = 14695981039346656037ULL;
+    for (int i = 0; i < E_INK_WIDTH * E_INK_HEIGHT / 4; i++)
+        hash = (hash ^ DMemory4Bit[i]) * 1099511628211ULL;
+    return hash;
+}
+
+void Inkplate::setPhaseCallback(PhaseCallback callback) {
+    phaseCallback = callback;
+}
+
+void Inkplate::phase(Phase _phase) {
+    if (phaseCallback != NULL)
+        phaseCallback(_phase);
+}
+
+void Inkplate::setDelayCallback(DelayCallback callback) {
+    delayCallback = callback;
+}
+
+// waits for BUSY without spinning (e.g. asleep until the pin changes), returning whether it did in time
+void Inkplate::setWaitCallback(WaitCallback callback) {
+    waitCallback = callback;
+}
+
+// how long the panel was busy with the last refresh (to the timeout if it did not finish), -1 if it was not
+// started
+int32_t Inkplate::refreshMillis() {
+    return refreshBusyMillis;
+}
+
+// queued transfers complete first: the delay callback may light sleep, which would stop the SPI clock mid
+// transaction
+void Inkplate::pause(uint32_t _ms) {
+    sendWait();
+    if (delayCallback != NULL)
+        delayCallback(_ms);
+    else
+        delay(_ms);
+}
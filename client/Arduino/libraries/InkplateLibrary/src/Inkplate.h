@@ -5,21 +5,63 @@
 #include "defines.h"
 #include "Graphics.h"
 
+/**
+ * @brief       Icon packed for one rotation: the icon's physical rows, each a mask of the pixels drawn
+ * then the bits for each plane (whole bytes, MSB first), PackBits compressed if ICON_RLE
+ */
+#define ICON_RLE 0x01
+typedef struct
+{
+    uint8_t rotation, flags;
+    uint8_t width, height;
+    const uint8_t *data;
+} Icon;
+
 class Inkplate : public Graphics
 {
   public:
+    typedef enum
+    {
+        PanelTransfer,
+        PanelWait,
+        PanelIdle,
+    } Phase;
+
+    typedef void (*PhaseCallback)(Phase phase);
+    typedef void (*DelayCallback)(uint32_t ms);
+    typedef bool (*WaitCallback)(uint8_t pin, uint8_t level, uint32_t timeout);
+
     Inkplate();
-    void begin();
-    bool display(void);
+    void begin(const uint8_t *base = NULL);
+    bool display(uint32_t timeout = REFRESH_TIMEOUT_MS);
+    int32_t refreshMillis();
     void clearDisplay();
+    uint64_t frameHash();
+    void drawIcon(int16_t x, int16_t y, const Icon *icon);
+    void restoreClip(const uint8_t *base);
+
+    void setPhaseCallback(PhaseCallback callback);
+    void setDelayCallback(DelayCallback callback);
+    void setWaitCallback(WaitCallback callback);
 
   private:
+    template <typename P> void drawIconPanel(int16_t x, int16_t y, const Icon *icon);
+    template <typename P> void restoreClipPanel(const uint8_t *base);
+
+    PhaseCallback phaseCallback = NULL;
+    DelayCallback delayCallback = NULL;
+    WaitCallback waitCallback = NULL;
+    uint32_t busyMillis = 0;
+    int32_t refreshBusyMillis = -1;
+    void phase(Phase _phase);
+    void pause(uint32_t _ms);
+
     void resetPanel();
-    void sendCommand(uint8_t _command);
-    void sendData(uint8_t *_data, int _n);
-    void sendData(uint8_t _data);
+    void sendCommand(uint8_t _command, const uint8_t *_data = NULL, int _n = 0);
+    void sendSequence(const uint8_t *_sequence, int _size);
+    void sendWait();
     bool setPanelDeepSleep(bool _state);
-    bool waitForEpd(uint16_t _timeout);
+    bool waitForEpd(uint32_t _timeout);
 };
 
 #endif
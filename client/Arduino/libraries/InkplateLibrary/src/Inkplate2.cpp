@@ -3,92 +3,486 @@
 #include "Inkplate.h"
 #include "Graphics.h"
 
-#include "SPI.h"
+#include "driver/gpio.h"
+#include "esp_heap_caps.h"
+#include "driver/spi_master.h"
 
-SPIClass epdSPI(VSPI);
+// the panel's SPI device, CS driven by the driver and DC by the pre-transfer callback from each
+// transaction's user field; transactions are queued and only waited for when they must have completed
+static spi_device_handle_t epdDevice = NULL;
+static spi_transaction_t epdTransactions[EPAPER_SPI_QUEUE];
+static int epdQueued = 0, epdNext = 0;
 
-SPISettings epdSpiSettings(1000000UL, MSBFIRST, SPI_MODE0);
+static void IRAM_ATTR epdPreTransfer(spi_transaction_t *_transaction)
+{
+    gpio_set_level((gpio_num_t)EPAPER_DC_PIN, (uint32_t)(intptr_t)_transaction->user);
+}
 
-void Graphics::writePixel(int16_t x0, int16_t y0, uint16_t _color)
+static bool epdBegin()
 {
-    if (x0 > width() - 1 || y0 > height() - 1 || x0 < 0 || y0 < 0)
+    if (epdDevice != NULL)
+        return true;
+
+    spi_bus_config_t _bus;
+    memset(&_bus, 0, sizeof(_bus));
+    _bus.mosi_io_num = EPAPER_DIN;
+    _bus.miso_io_num = -1;
+    _bus.sclk_io_num = EPAPER_CLK;
+    _bus.quadwp_io_num = -1;
+    _bus.quadhd_io_num = -1;
+    _bus.max_transfer_sz = E_INK_WIDTH * E_INK_HEIGHT / 8;
+    if (spi_bus_initialize(SPI3_HOST, &_bus, SPI_DMA_CH_AUTO) != ESP_OK)
+        return false;
+
+    spi_device_interface_config_t _device;
+    memset(&_device, 0, sizeof(_device));
+    _device.mode = 0;
+    _device.clock_speed_hz = EPAPER_SPI_HZ;
+    _device.spics_io_num = EPAPER_CS_PIN;
+    _device.cs_ena_pretrans = 1;
+    _device.cs_ena_posttrans = 1;
+    _device.queue_size = EPAPER_SPI_QUEUE;
+    _device.pre_cb = epdPreTransfer;
+    if (spi_bus_add_device(SPI3_HOST, &_device, &epdDevice) != ESP_OK)
+    {
+        spi_bus_free(SPI3_HOST);
+        epdDevice = NULL;
+        return false;
+    }
+    epdQueued = epdNext = 0;
+    return true;
+}
+
+static void epdEnd()
+{
+    if (epdDevice == NULL)
         return;
+    spi_bus_remove_device(epdDevice);
+    spi_bus_free(SPI3_HOST);
+    epdDevice = NULL;
+}
+
+static void epdCollect()
+{
+    spi_transaction_t *_done;
+    spi_device_get_trans_result(epdDevice, &_done, portMAX_DELAY);
+    epdQueued--;
+}
+
+// up to 4 bytes go in the transaction itself, anything longer is streamed from the buffer by DMA (which
+// must stay untouched until sendWait); completed slots are collected in order before being reused
+static void epdQueue(bool _data, const uint8_t *_bytes, int _n)
+{
+    if (epdQueued == EPAPER_SPI_QUEUE)
+        epdCollect();
+    spi_transaction_t *_transaction = &epdTransactions[epdNext];
+    epdNext = (epdNext + 1) % EPAPER_SPI_QUEUE;
+
+    memset(_transaction, 0, sizeof(*_transaction));
+    _transaction->length = 8 * _n;
+    _transaction->user = (void *)(intptr_t)_data;
+    if (_n <= 4)
+    {
+        _transaction->flags = SPI_TRANS_USE_TXDATA;
+        memcpy(_transaction->tx_data, _bytes, _n);
+    }
+    else
+        _transaction->tx_buffer = _bytes;
+    spi_device_queue_trans(epdDevice, _transaction, portMAX_DELAY);
+    epdQueued++;
+}
+
+void Graphics::includeBounds(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+    if (x0 < boundsX0)
+        boundsX0 = x0;
+    if (x1 > boundsX1)
+        boundsX1 = x1;
+    if (y0 < boundsY0)
+        boundsY0 = y0;
+    if (y1 > boundsY1)
+        boundsY1 = y1;
+}
+
+template <typename P> void Graphics::writePixelPanel(int16_t x0, int16_t y0, uint16_t _color)
+{
+    if (x0 < clipX0 || x0 > clipX1 || y0 < clipY0 || y0 > clipY1)
+        return;
+    if (bounding)
+    {
+        includeBounds(x0, y0, x0, y0);
+        if (measuring)
+            return;
+    }
+    P::write(DMemory4Bit, x0, y0, _color);
+}
+
+template <typename P> void Graphics::writeSpanPanel(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t _color)
+{
+    int x1 = x + w - 1, y1 = y + h - 1, x0 = x < clipX0 ? clipX0 : x, y0 = y < clipY0 ? clipY0 : y;
+    if (x1 > clipX1)
+        x1 = clipX1;
+    if (y1 > clipY1)
+        y1 = clipY1;
+    if (x0 > x1 || y0 > y1)
+        return;
+    if (bounding)
+    {
+        includeBounds(x0, y0, x1, y1);
+        if (measuring)
+            return;
+    }
+    P::fill(DMemory4Bit, x0, y0, x1, y1, _color);
+}
+
+template <typename P>
+void Graphics::writeGlyphPanel(int16_t x, int16_t y, int16_t w, int16_t h, const uint8_t *bitmap, const uint8_t *rows,
+                               uint16_t _color)
+{
+    int px0, py0, px1, py1, cx0, cy0, cx1, cy1;
+    P::physical(x, y, x + w - 1, y + h - 1, &px0, &py0, &px1, &py1);
+    P::physical(clipX0, clipY0, clipX1, clipY1, &cx0, &cy0, &cx1, &cy1);
+    const int pw = px1 - px0 + 1, ph = py1 - py0 + 1;
+    const int _stride = (pw + 7) / 8;
+
+    uint8_t _rotated[56 / 8 * 56];
+    if (rows == NULL)
+    {
+        memset(_rotated, 0, _stride * ph);
+        uint8_t bits = 0, bit = 0;
+        for (int yy = 0; yy < h; yy++)
+            for (int xx = 0; xx < w; xx++, bits <<= 1)
+            {
+                if (!(bit++ & 7))
+                    bits = pgm_read_byte(bitmap++);
+                if (bits & 0x80)
+                {
+                    const int _x = P::physicalX(x + xx, y + yy) - px0, _y = P::physicalY(x + xx, y + yy) - py0;
+                    _rotated[_stride * _y + (_x >> 3)] |= 0x80 >> (_x & 7);
+                }
+            }
+        rows = _rotated;
+    }
+
+    const int _first = px0 >> 3, _shift = px0 & 7, _bytes = (pw + _shift + 7) / 8;
+    for (int _y = py0; _y < py0 + ph; _y++, rows += _stride)
+    {
+        if (_y < cy0 || _y > cy1)
+            continue;
+        uint64_t _bits = 0;
+        for (int k = 0; k < _stride; k++)
+            _bits |= (uint64_t)rows[k] << (56 - 8 * k);
+        _bits >>= _shift;
+        for (int k = 0; k < _bytes; k++)
+        {
+            const uint8_t _mask = (_bits >> (56 - 8 * k)) & P::columnMask(_first + k, cx0, cx1);
+            if (_mask)
+                P::write(DMemory4Bit, P::stride * _y + _first + k, _mask, _color);
+        }
+    }
+}
+
+// a glyph is rejected against the clip as a whole, rotated into physical rows (or taken already rotated from a glyph
+// cache), then each row within the clip is shifted into place and written a byte at a time into both planes, masked
+// to the clip's columns
+void Graphics::writeGlyph(int16_t x, int16_t y, uint8_t c, uint16_t _color)
+{
     if (_color > 2)
         return;
 
+    const uint8_t first = pgm_read_byte(&gfxFont->first);
+    const GFXglyph *glyph = gfxFont->glyph + (c - first);
+    const uint8_t *bitmap = gfxFont->bitmap + pgm_read_dword(&glyph->bitmapOffset);
+    const int16_t w = pgm_read_byte(&glyph->width), h = pgm_read_byte(&glyph->height);
+    x += (int8_t)pgm_read_byte(&glyph->xOffset);
+    y += (int8_t)pgm_read_byte(&glyph->yOffset);
+    if (clipRejects(x, y, x + w - 1, y + h - 1))
+        return;
+
+    if (bounding)
+    {
+        includeBounds(x < clipX0 ? clipX0 : x, y < clipY0 ? clipY0 : y, x + w - 1 > clipX1 ? clipX1 : x + w - 1,
+                      y + h - 1 > clipY1 ? clipY1 : y + h - 1);
+        if (measuring)
+            return;
+    }
+
+    if (w > 56 || h > 56)
+    {
+        uint8_t bits = 0, bit = 0;
+        for (int yy = 0; yy < h; yy++)
+            for (int xx = 0; xx < w; xx++, bits <<= 1)
+            {
+                if (!(bit++ & 7))
+                    bits = pgm_read_byte(bitmap++);
+                if (bits & 0x80)
+                    writePixel(x + xx, y + yy, _color);
+            }
+        return;
+    }
+
+    const uint8_t *rows = NULL;
+    for (int i = 0; i < glyphCacheCount && rows == NULL; i++)
+    {
+        const GlyphCache *cache = &glyphCaches[i];
+        if (cache->font == gfxFont && cache->rotation == rotation && c >= cache->first && c <= cache->last &&
+            cache->offsets[c - cache->first] != GLYPH_UNCACHED)
+            rows = cache->bitmap + cache->offsets[c - cache->first];
+    }
+
     switch (rotation)
     {
+    case 0:
+        writeGlyphPanel<Inkplate2Panel<0>>(x, y, w, h, bitmap, rows, _color);
+        break;
+    case 1:
+        writeGlyphPanel<Inkplate2Panel<1>>(x, y, w, h, bitmap, rows, _color);
+        break;
+    case 2:
+        writeGlyphPanel<Inkplate2Panel<2>>(x, y, w, h, bitmap, rows, _color);
+        break;
     case 3:
-        _swap_int16_t(x0, y0);
-        x0 = height() - x0 - 1;
+        writeGlyphPanel<Inkplate2Panel<3>>(x, y, w, h, bitmap, rows, _color);
         break;
+    }
+}
+
+// reads an icon's rows, raw or PackBits (n >= 0: n + 1 literal bytes, n < 0: the next byte 1 - n times)
+class IconReader
+{
+  public:
+    IconReader(const uint8_t *data, bool rle) : data(data), rle(rle){};
+    uint8_t next()
+    {
+        if (!rle)
+            return pgm_read_byte(data++);
+        if (count == 0)
+        {
+            const int8_t n = pgm_read_byte(data++);
+            repeat = n < 0;
+            count = repeat ? 1 - n : n + 1;
+        }
+        if (--count > 0 && repeat)
+            return pgm_read_byte(data);
+        return pgm_read_byte(data++);
+    }
+
+  private:
+    const uint8_t *data;
+    const bool rle;
+    bool repeat = false;
+    int count = 0;
+};
+
+template <typename P> void Inkplate::drawIconPanel(int16_t x, int16_t y, const Icon *icon)
+{
+    int px0, py0, px1, py1, cx0, cy0, cx1, cy1;
+    P::physical(x, y, x + icon->width - 1, y + icon->height - 1, &px0, &py0, &px1, &py1);
+    P::physical(clipX0, clipY0, clipX1, clipY1, &cx0, &cy0, &cx1, &cy1);
+    const int pw = px1 - px0 + 1, ph = py1 - py0 + 1;
+    const int _stride = (pw + 7) / 8, _first = px0 >> 3, _shift = px0 & 7;
+    if (_stride > 32)
+        return;
+
+    IconReader reader(icon->data, icon->flags & ICON_RLE);
+    uint8_t _row[(1 + P::planes) * 32];
+    for (int _y = py0; _y < py0 + ph; _y++)
+    {
+        for (int k = 0; k < (1 + P::planes) * _stride; k++)
+            _row[k] = reader.next();
+        if (_y < cy0 || _y > cy1)
+            continue;
+        for (int k = 0; k <= _stride; k++)
+        {
+            const uint8_t _clip = P::columnMask(_first + k, cx0, cx1);
+            if (_clip == 0)
+                continue;
+            uint8_t _bytes[1 + P::planes];
+            for (int n = 0; n < 1 + P::planes; n++)
+            {
+                const uint8_t *_src = _row + _stride * n;
+                _bytes[n] = (k < _stride ? _src[k] >> _shift : 0) | (k > 0 && _shift ? _src[k - 1] << (8 - _shift) : 0);
+            }
+            _bytes[0] &= _clip;
+            if (_bytes[0] == 0)
+                continue;
+            for (int n = 0; n < P::planes; n++)
+            {
+                uint8_t *_at = DMemory4Bit + P::plane * n + P::stride * _y + _first + k;
+                *_at = (*_at & ~_bytes[0]) | (_bytes[1 + n] & _bytes[0]);
+            }
+        }
+    }
+}
+
+// icons are packed for one rotation and only drawn at that rotation, rejected against the clip as a whole
+// and then masked to it a byte at a time
+void Inkplate::drawIcon(int16_t x, int16_t y, const Icon *icon)
+{
+    if (icon->rotation != rotation)
+        return;
+    const int16_t x1 = x + icon->width - 1, y1 = y + icon->height - 1;
+    if (clipRejects(x, y, x1, y1))
+        return;
+
+    if (bounding)
+    {
+        includeBounds(x < clipX0 ? clipX0 : x, y < clipY0 ? clipY0 : y, x1 > clipX1 ? clipX1 : x1,
+                      y1 > clipY1 ? clipY1 : y1);
+        if (measuring)
+            return;
+    }
+
+    switch (rotation)
+    {
     case 0:
-        x0 = width() - x0 - 1;
-        y0 = height() - y0 - 1;
+        drawIconPanel<Inkplate2Panel<0>>(x, y, icon);
         break;
     case 1:
-        _swap_int16_t(x0, y0);
-        y0 = width() - y0 - 1;
+        drawIconPanel<Inkplate2Panel<1>>(x, y, icon);
+        break;
+    case 2:
+        drawIconPanel<Inkplate2Panel<2>>(x, y, icon);
+        break;
+    case 3:
+        drawIconPanel<Inkplate2Panel<3>>(x, y, icon);
         break;
     }
+}
 
-    int _x = x0 / 8;
-    int _xSub = x0 % 8;
-
-    int _position = E_INK_WIDTH / 8 * y0 + _x;
+template <typename P> void Inkplate::restoreClipPanel(const uint8_t *base)
+{
+    P::copy(DMemory4Bit, base, clipX0, clipY0, clipX1, clipY1);
+}
 
-    *(DMemory4Bit + _position) |= (pixelMaskLUT[7 - _xSub]);
-    *(DMemory4Bit + (E_INK_WIDTH * E_INK_HEIGHT / 8) + _position) |= (pixelMaskLUT[7 - _xSub]);
+// the current clip taken back from base, a frame in the panel's layout (as begin takes), such as the prebuilt
+// frame the drawing started from
+void Inkplate::restoreClip(const uint8_t *base)
+{
+    if (clipX0 > clipX1 || clipY0 > clipY1 || measuring)
+        return;
 
-    if (_color < 2)
-        *(DMemory4Bit + _position) &= ~(_color << (7 - _xSub));
-    else
-        *(DMemory4Bit + (E_INK_WIDTH * E_INK_HEIGHT / 8) + _position) &= ~(pixelMaskLUT[7 - _xSub]);
+    switch (rotation)
+    {
+    case 0:
+        restoreClipPanel<Inkplate2Panel<0>>(base);
+        break;
+    case 1:
+        restoreClipPanel<Inkplate2Panel<1>>(base);
+        break;
+    case 2:
+        restoreClipPanel<Inkplate2Panel<2>>(base);
+        break;
+    case 3:
+        restoreClipPanel<Inkplate2Panel<3>>(base);
+        break;
+    }
 }
 
-void Inkplate::begin () {
-	DMemory4Bit = (uint8_t *)ps_malloc(E_INK_WIDTH * E_INK_HEIGHT / 4);
+// rotation is resolved once per call, everything below it is the constexpr addressing in Panel.h
+void Graphics::writePixel(int16_t x0, int16_t y0, uint16_t _color)
+{
+    if (_color > 2)
+        return;
+
+    switch (rotation)
+    {
+    case 0:
+        writePixelPanel<Inkplate2Panel<0>>(x0, y0, _color);
+        break;
+    case 1:
+        writePixelPanel<Inkplate2Panel<1>>(x0, y0, _color);
+        break;
+    case 2:
+        writePixelPanel<Inkplate2Panel<2>>(x0, y0, _color);
+        break;
+    case 3:
+        writePixelPanel<Inkplate2Panel<3>>(x0, y0, _color);
+        break;
+    }
+}
 
-	clearDisplay();
+void Graphics::writeSpan(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t _color)
+{
+    if (_color > 2)
+        return;
+    if (w < 0)
+    {
+        x += w + 1;
+        w = -w;
+    }
+    if (h < 0)
+    {
+        y += h + 1;
+        h = -h;
+    }
 
-	setRotation(1);
+    switch (rotation)
+    {
+    case 0:
+        writeSpanPanel<Inkplate2Panel<0>>(x, y, w, h, _color);
+        break;
+    case 1:
+        writeSpanPanel<Inkplate2Panel<1>>(x, y, w, h, _color);
+        break;
+    case 2:
+        writeSpanPanel<Inkplate2Panel<2>>(x, y, w, h, _color);
+        break;
+    case 3:
+        writeSpanPanel<Inkplate2Panel<3>>(x, y, w, h, _color);
+        break;
+    }
 }
 
-bool Inkplate::display() {
-    if (!setPanelDeepSleep(false))
-    	return false;
-    delay(20);
+void Inkplate::begin (const uint8_t *base) {
+	// from internal memory the SPI DMA can read: epdQueue streams both planes straight out of the frame
+	DMemory4Bit = (uint8_t *)heap_caps_malloc(E_INK_WIDTH * E_INK_HEIGHT / 4, MALLOC_CAP_DMA);
 
-    sendCommand(0x10);
-    sendData(DMemory4Bit, (E_INK_WIDTH * E_INK_HEIGHT / 8));
+	if (base != NULL)
+		memcpy(DMemory4Bit, base, E_INK_WIDTH * E_INK_HEIGHT / 4); // prebuilt frame, already rotated
+	else
+		clearDisplay();
 
-    sendCommand(0x13);
-    sendData(DMemory4Bit + (E_INK_WIDTH * E_INK_HEIGHT / 8), (E_INK_WIDTH * E_INK_HEIGHT / 8));
+	setRotation(1);
+}
 
-    sendCommand(0x11);
-    sendData(0x00);
+// false if the panel could not be woken, or did not finish the refresh within the timeout
+bool Inkplate::display(uint32_t _timeout) {
+    refreshBusyMillis = -1;
+    phase(PanelTransfer);
+    if (!setPanelDeepSleep(false))
+    {
+        phase(PanelIdle);
+        return false;
+    }
+    pause(20);
 
-    sendCommand(0x12);
+    static const uint8_t _refresh[] = {0x11, 1, 0x00, 0x12, 0};
+    sendCommand(0x10, DMemory4Bit, E_INK_WIDTH * E_INK_HEIGHT / 8);
+    sendCommand(0x13, DMemory4Bit + (E_INK_WIDTH * E_INK_HEIGHT / 8), E_INK_WIDTH * E_INK_HEIGHT / 8);
+    sendSequence(_refresh, sizeof(_refresh));
+    sendWait();
     delayMicroseconds(500);
-    waitForEpd(60000);
+    const bool _refreshed = waitForEpd(_timeout);
+    refreshBusyMillis = busyMillis;
 
     setPanelDeepSleep(true);
+    phase(PanelIdle);
 
-    return true;
+    return _refreshed;
 }
 
 bool Inkplate::setPanelDeepSleep(bool _state)
 {
     if (!_state)
     {
-        epdSPI.begin(EPAPER_CLK, -1, EPAPER_DIN, -1);
-
-        pinMode(EPAPER_CS_PIN, OUTPUT);
         pinMode(EPAPER_DC_PIN, OUTPUT);
         pinMode(EPAPER_RST_PIN, OUTPUT);
         pinMode(EPAPER_BUSY_PIN, INPUT_PULLUP);
+        if (!epdBegin())
+            return false;
 
-        delay(10);
+        pause(10);
 
         resetPanel();
 
@@ -96,31 +490,22 @@ bool Inkplate::setPanelDeepSleep(bool _state)
         if (!waitForEpd(BUSY_TIMEOUT_MS))
             return false;
 
-        sendCommand(0x00);
-        sendData(0x0f);
-        sendData(0x89);
-
-        sendCommand(0x61);
-        sendData(E_INK_WIDTH);
-        sendData(E_INK_HEIGHT >> 8);
-        sendData(E_INK_HEIGHT & 0xff);
-
-        sendCommand(0x50);
-        sendData(0x77);
+        static const uint8_t _setup[] = {0x00, 2, 0x0f, 0x89,
+                                         0x61, 3, E_INK_WIDTH, E_INK_HEIGHT >> 8, E_INK_HEIGHT & 0xff,
+                                         0x50, 1, 0x77};
+        sendSequence(_setup, sizeof(_setup));
 
         return true;
     }
     else
     {
-        sendCommand(0X50);
-        sendData(0xf7);
-        sendCommand(0X02);
+        static const uint8_t _off[] = {0x50, 1, 0xf7, 0x02, 0}, _sleep[] = {0x07, 1, 0xA5};
+        sendSequence(_off, sizeof(_off));
         waitForEpd(BUSY_TIMEOUT_MS);
-        sendCommand(0X07);
-        sendData(0xA5);
-        delay(1);
+        sendSequence(_sleep, sizeof(_sleep));
+        sendWait();
 
-        epdSPI.end();
+        epdEnd();
 
         pinMode(EPAPER_RST_PIN, INPUT);
         pinMode(EPAPER_DC_PIN, INPUT);
@@ -136,54 +521,56 @@ bool Inkplate::setPanelDeepSleep(bool _state)
 void Inkplate::resetPanel()
 {
     digitalWrite(EPAPER_RST_PIN, LOW);
-    delay(100);
+    pause(100);
     digitalWrite(EPAPER_RST_PIN, HIGH);
-    delay(100);
+    pause(100);
 }
 
-void Inkplate::sendCommand(uint8_t _command)
+// a command and its data are queued as two transactions and return at once, so the commands of a
+// sequence go out back to back; anything that depends on the panel having them calls sendWait first
+void Inkplate::sendCommand(uint8_t _command, const uint8_t *_data, int _n)
 {
-    digitalWrite(EPAPER_CS_PIN, LOW);
-    digitalWrite(EPAPER_DC_PIN, LOW);
-    delayMicroseconds(10);
-    epdSPI.beginTransaction(epdSpiSettings);
-    epdSPI.transfer(_command);
-    epdSPI.endTransaction();
-    digitalWrite(EPAPER_CS_PIN, HIGH);
-    delay(1);
+    epdQueue(false, &_command, 1);
+    if (_n > 0)
+        epdQueue(true, _data, _n);
 }
 
-void Inkplate::sendData(uint8_t *_data, int _n)
+// commands each followed by a count and that many data bytes
+void Inkplate::sendSequence(const uint8_t *_sequence, int _size)
 {
-    digitalWrite(EPAPER_CS_PIN, LOW);
-    digitalWrite(EPAPER_DC_PIN, HIGH);
-    delayMicroseconds(10);
-    epdSPI.beginTransaction(epdSpiSettings);
-    epdSPI.writeBytes(_data, _n);
-    epdSPI.endTransaction();
-    digitalWrite(EPAPER_CS_PIN, HIGH);
-    delay(1);
+    for (int i = 0; i + 1 < _size; i += 2 + _sequence[i + 1])
+        sendCommand(_sequence[i], _sequence + i + 2, _sequence[i + 1]);
 }
 
-void Inkplate::sendData(uint8_t _data)
+void Inkplate::sendWait()
 {
-    digitalWrite(EPAPER_CS_PIN, LOW);
-    digitalWrite(EPAPER_DC_PIN, HIGH);
-    delayMicroseconds(10);
-    epdSPI.beginTransaction(epdSpiSettings);
-    epdSPI.transfer(_data);
-    epdSPI.endTransaction();
-    digitalWrite(EPAPER_CS_PIN, HIGH);
-    delay(1);
+    while (epdQueued > 0)
+        epdCollect();
 }
 
-bool Inkplate::waitForEpd(uint16_t _timeout)
+// the transfers complete before the wait phase, whose callback may lower the CPU clock (and with it the
+// APB clock the SPI clock is divided from); BUSY is low while the panel works, waited for by the wait
+// callback if there is one, otherwise by polling
+bool Inkplate::waitForEpd(uint32_t _timeout)
 {
-    unsigned long _time = millis();
-    while (!digitalRead(EPAPER_BUSY_PIN) && ((millis() - _time) < _timeout))
-        ;
+    sendWait();
+    phase(PanelWait);
+    const unsigned long _time = millis();
     if (!digitalRead(EPAPER_BUSY_PIN))
+    {
+        if (waitCallback != NULL)
+            waitCallback(EPAPER_BUSY_PIN, HIGH, _timeout);
+        else
+            while (!digitalRead(EPAPER_BUSY_PIN) && ((millis() - _time) < _timeout))
+                ;
+    }
+    busyMillis = millis() - _time;
+    if (!digitalRead(EPAPER_BUSY_PIN))
+    {
+        phase(PanelTransfer);
         return false;
-    delay(200);
+    }
+    pause(200);
+    phase(PanelTransfer);
     return true;
 }
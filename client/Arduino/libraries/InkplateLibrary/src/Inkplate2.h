@@ -9,7 +9,11 @@
 #define EPAPER_CLK      18
 #define EPAPER_DIN      23
 
-#define BUSY_TIMEOUT_MS 1000
+#define BUSY_TIMEOUT_MS    1000
+#define REFRESH_TIMEOUT_MS 60000
+
+#define EPAPER_SPI_HZ    10000000 // the controller's rated write clock
+#define EPAPER_SPI_QUEUE 8
 
 #define E_INK_HEIGHT 212
 #define E_INK_WIDTH  104
@@ -18,6 +22,10 @@
 #define INKPLATE2_BLACK 1
 #define INKPLATE2_RED   2
 
+#include "Panel.h"
+
+template <int R> using Inkplate2Panel = Panel<E_INK_WIDTH, E_INK_HEIGHT, 2, R>;
+
 #ifndef min
 #define min(a, b) (((a) < (b)) ? (a) : (b))
 #endif
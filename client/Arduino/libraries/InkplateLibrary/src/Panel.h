@@ -0,0 +1,141 @@
+
+#ifndef __PANEL_H__
+#define __PANEL_H__
+
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * @brief       Compile-time framebuffer addressing for a W x H panel with P bitplanes viewed at rotation R.
+ *              Plane p holds one bit per pixel, MSB leftmost, rows of W / 8 bytes; a pixel is written by
+ *              setting it in every plane then clearing it in plane (color - 1), so color 0 leaves it set.
+ *              All address math is constexpr and shift/mask only, so each instance compiles to straight
+ *              line code for its rotation.
+ */
+template <int W, int H, int P, int R> struct Panel
+{
+    static_assert(W % 8 == 0, "panel width must be a whole number of bytes");
+    static_assert(P >= 1 && P <= 8, "panel plane count out of range");
+    static_assert(R >= 0 && R <= 3, "panel rotation out of range");
+
+    static constexpr int physicalWidth = W, physicalHeight = H, planes = P;
+    static constexpr int stride = W / 8, plane = W * H / 8, size = plane * P;
+    static constexpr int width = (R & 1) ? H : W, height = (R & 1) ? W : H;
+
+    static constexpr bool inside(int x, int y)
+    {
+        return (unsigned)x < (unsigned)width && (unsigned)y < (unsigned)height;
+    }
+    static constexpr int physicalX(int x, int y)
+    {
+        return R == 0 ? W - 1 - x : R == 1 ? y : R == 2 ? x : W - 1 - y;
+    }
+    static constexpr int physicalY(int x, int y)
+    {
+        return R == 0 ? H - 1 - y : R == 1 ? H - 1 - x : R == 2 ? y : x;
+    }
+    static constexpr int offset(int x, int y)
+    {
+        return stride * physicalY(x, y) + (physicalX(x, y) >> 3);
+    }
+    static constexpr uint8_t mask(int x, int y)
+    {
+        return 0x80 >> (physicalX(x, y) & 7);
+    }
+
+    // the bits of physical row byte b that lie within physical columns px0 to px1
+    static constexpr uint8_t columnMask(int b, int px0, int px1)
+    {
+        return px1 < 8 * b || px0 > 8 * b + 7
+                   ? 0
+                   : (0xFF >> (px0 > 8 * b ? px0 - 8 * b : 0)) & (0xFF << (px1 < 8 * b + 7 ? 8 * b + 7 - px1 : 0));
+    }
+
+    // the physical rectangle covered by the inclusive logical rectangle x0, y0, x1, y1
+    static inline void physical(int x0, int y0, int x1, int y1, int *px0, int *py0, int *px1, int *py1)
+    {
+        const int _a = physicalX(x0, y0), _b = physicalX(x1, y1), _c = physicalY(x0, y0), _d = physicalY(x1, y1);
+        *px0 = _a < _b ? _a : _b;
+        *px1 = _a < _b ? _b : _a;
+        *py0 = _c < _d ? _c : _d;
+        *py1 = _c < _d ? _d : _c;
+    }
+
+    static inline void write(uint8_t *buffer, int offset, uint8_t mask, uint8_t color)
+    {
+        for (int p = 0; p < P; p++)
+            buffer[plane * p + offset] = (buffer[plane * p + offset] | mask) & ~(color == p + 1 ? mask : 0);
+    }
+    static inline void write(uint8_t *buffer, int x, int y, uint8_t color)
+    {
+        write(buffer, offset(x, y), mask(x, y), color);
+    }
+
+    // inclusive logical rectangle, already clipped: map its corners once, then each physical row is
+    // a masked byte at either end and whole bytes between (one block per plane when rows are full width)
+    static inline void fill(uint8_t *buffer, int x0, int y0, int x1, int y1, uint8_t color)
+    {
+        int px0, py0, px1, py1;
+        physical(x0, y0, x1, y1, &px0, &py0, &px1, &py1);
+
+        if (px0 == 0 && px1 == W - 1)
+        {
+            for (int p = 0; p < P; p++)
+                memset(buffer + plane * p + stride * py0, color == p + 1 ? 0x00 : 0xFF, stride * (py1 - py0 + 1));
+            return;
+        }
+
+        const int _b0 = px0 >> 3, _b1 = px1 >> 3;
+        const uint8_t _m0 = 0xFF >> (px0 & 7), _m1 = 0xFF << (7 - (px1 & 7));
+        for (int p = 0; p < P; p++)
+        {
+            const uint8_t _set = color == p + 1 ? 0x00 : 0xFF;
+            uint8_t *_row = buffer + plane * p + stride * py0;
+            for (int _y = py0; _y <= py1; _y++, _row += stride)
+            {
+                if (_b0 == _b1)
+                {
+                    _row[_b0] = (_row[_b0] & ~(_m0 & _m1)) | (_set & _m0 & _m1);
+                    continue;
+                }
+                _row[_b0] = (_row[_b0] & ~_m0) | (_set & _m0);
+                if (_b1 - _b0 > 1)
+                    memset(_row + _b0 + 1, _set, _b1 - _b0 - 1);
+                _row[_b1] = (_row[_b1] & ~_m1) | (_set & _m1);
+            }
+        }
+    }
+
+    // inclusive logical rectangle, already clipped: the same physical rows taken from source, a frame in
+    // this layout, with the end bytes merged under their column masks
+    static inline void copy(uint8_t *buffer, const uint8_t *source, int x0, int y0, int x1, int y1)
+    {
+        int px0, py0, px1, py1;
+        physical(x0, y0, x1, y1, &px0, &py0, &px1, &py1);
+
+        if (px0 == 0 && px1 == W - 1)
+        {
+            for (int p = 0; p < P; p++)
+                memcpy(buffer + plane * p + stride * py0, source + plane * p + stride * py0, stride * (py1 - py0 + 1));
+            return;
+        }
+
+        const int _b0 = px0 >> 3, _b1 = px1 >> 3;
+        const uint8_t _m0 = columnMask(_b0, px0, px1), _m1 = columnMask(_b1, px0, px1);
+        for (int p = 0; p < P; p++)
+        {
+            uint8_t *_row = buffer + plane * p + stride * py0;
+            const uint8_t *_from = source + plane * p + stride * py0;
+            for (int _y = py0; _y <= py1; _y++, _row += stride, _from += stride)
+            {
+                _row[_b0] = (_row[_b0] & ~_m0) | (_from[_b0] & _m0);
+                if (_b1 - _b0 > 1)
+                    memcpy(_row + _b0 + 1, _from + _b0 + 1, _b1 - _b0 - 1);
+                if (_b1 != _b0)
+                    _row[_b1] = (_row[_b1] & ~_m1) | (_from[_b1] & _m1);
+            }
+        }
+    }
+};
+
+#endif
@@ -1,15 +1,16 @@
 
 #include "Shapes.h"
 
+// midpoint ellipse in integers, the decision variables scaled by 4 to drop the 0.25 and 0.5 terms
 void Shapes::drawElipse(int rx, int ry, int xc, int yc, int c)
 {
-    float dx, dy, d1, d2, x, y;
-    x = 0;
-    y = ry;
+    if (clipRejects(xc - rx, yc - ry, xc + rx, yc + ry))
+        return;
 
-    d1 = (ry * ry) - (rx * rx * ry) + (0.25 * rx * rx);
-    dx = 2 * ry * ry * x;
-    dy = 2 * rx * rx * y;
+    const int32_t rx2 = rx * rx, ry2 = ry * ry;
+    int x = 0, y = ry;
+    int32_t dx = 0, dy = 2 * rx2 * y;
+    int64_t d1 = 4 * (int64_t)ry2 - 4 * (int64_t)rx2 * ry + rx2;
 
     while (dx < dy)
     {
@@ -21,20 +22,20 @@ void Shapes::drawElipse(int rx, int ry, int xc, int yc, int c)
         if (d1 < 0)
         {
             x++;
-            dx = dx + (2 * ry * ry);
-            d1 = d1 + dx + (ry * ry);
+            dx = dx + (2 * ry2);
+            d1 = d1 + 4 * ((int64_t)dx + ry2);
         }
         else
         {
             x++;
             y--;
-            dx = dx + (2 * ry * ry);
-            dy = dy - (2 * rx * rx);
-            d1 = d1 + dx - dy + (ry * ry);
+            dx = dx + (2 * ry2);
+            dy = dy - (2 * rx2);
+            d1 = d1 + 4 * ((int64_t)dx - dy + ry2);
         }
     }
 
-    d2 = ((ry * ry) * ((x + 0.5) * (x + 0.5))) + ((rx * rx) * ((y - 1) * (y - 1))) - (rx * rx * ry * ry);
+    int64_t d2 = (int64_t)ry2 * (2 * x + 1) * (2 * x + 1) + 4 * (int64_t)rx2 * (y - 1) * (y - 1) - 4 * (int64_t)rx2 * ry2;
     while (y >= 0)
     {
         drawPixel(x + xc, y + yc, c);
@@ -45,30 +46,32 @@ void Shapes::drawElipse(int rx, int ry, int xc, int yc, int c)
         if (d2 > 0)
         {
             y--;
-            dy = dy - (2 * rx * rx);
-            d2 = d2 + (rx * rx) - dy;
+            dy = dy - (2 * rx2);
+            d2 = d2 + 4 * ((int64_t)rx2 - dy);
         }
         else
         {
             y--;
             x++;
-            dx = dx + (2 * ry * ry);
-            dy = dy - (2 * rx * rx);
-            d2 = d2 + dx - dy + (rx * rx);
+            dx = dx + (2 * ry2);
+            dy = dy - (2 * rx2);
+            d2 = d2 + 4 * ((int64_t)dx - dy + rx2);
         }
     }
 }
 
 void Shapes::fillElipse(int rx, int ry, int xc, int yc, int c)
 {
+    if (clipRejects(xc - rx, yc - ry, xc + rx, yc + ry))
+        return;
+
     int hh = ry * ry;
     int ww = rx * rx;
     int hhww = hh * ww;
     int x0 = rx;
     int dx = 0;
 
-    for (int x = -rx; x <= rx; x++)
-        drawPixel(xc + x, yc, c);
+    drawFastHLine(xc - rx, yc, 2 * rx + 1, c);
 
     for (int y = 1; y <= ry; y++)
     {
@@ -79,242 +82,83 @@ void Shapes::fillElipse(int rx, int ry, int xc, int yc, int c)
         dx = x0 - x1;
         x0 = x1;
 
-        for (int x = -x0; x <= x0; x++)
-        {
-            drawPixel(xc + x, yc - y, c);
-            drawPixel(xc + x, yc + y, c);
-        }
-    }
-}
-
-void Shapes::drawThickLine(int x1, int y1, int x2, int y2, int color, float thickness)
-{
-    float deg = atan2f((float)(y2 - y1), (float)(x2 - x1));
-
-    float l1 = tan(deg);
-
-    float degShift = (l1 < 0 ? M_PI_2 : -M_PI_2);
-
-    int x3 = (int)round((float)x1 + thickness / 2.0 * cos(deg + degShift));
-    int y3 = (int)round((float)y1 + thickness / 2.0 * sin(deg + degShift));
-
-    int x4 = (int)round((float)x2 + thickness / 2.0 * cos(deg + degShift));
-    int y4 = (int)round((float)y2 + thickness / 2.0 * sin(deg + degShift));
-
-    x1 = (int)round((float)x1 + thickness / 2.0 * cos(deg - degShift));
-    y1 = (int)round((float)y1 + thickness / 2.0 * sin(deg - degShift));
-
-    x2 = (int)round((float)x2 + thickness / 2.0 * cos(deg - degShift));
-    y2 = (int)round((float)y2 + thickness / 2.0 * sin(deg - degShift));
-
-    fillTriangle(x1, y1, x2, y2, x3, y3, color);
-    fillTriangle(x2, y2, x4, y4, x3, y3, color);
-}
-
-void Shapes::drawGradientLine(int x1, int y1, int x2, int y2, int color1, int color2, float thickness)
-{
-    int n = color2 - color1;
-
-    float px = (float)(x2 - x1) / (float)n;
-    float py = (float)(y2 - y1) / (float)n;
-
-    for (int i = 0; i < n; ++i)
-    {
-        if (abs(thickness + 1) < 0.1)
-            drawLine((int)((float)x1 + (float)i * px), (int)((float)y1 + (float)i * py),
-                     (int)((float)x1 + (float)(i + 1) * px), (int)((float)y1 + (float)(i + 1) * py), color1 + i);
-        else
-            drawThickLine((int)((float)x1 + (float)i * px), (int)((float)y1 + (float)i * py),
-                          (int)((float)x1 + (float)(i + 1) * px), (int)((float)y1 + (float)(i + 1) * py), color1 + i,
-                          thickness);
+        drawFastHLine(xc - x0, yc - y, 2 * x0 + 1, c);
+        drawFastHLine(xc - x0, yc + y, 2 * x0 + 1, c);
     }
 }
 
-void Shapes::initedgeTable()
-{
-    int i;
-    for (i = 0; i < maxHt; i++)
-        edgeTable[i].countEdgeBucket = 0;
-    activeEdgeTuple.countEdgeBucket = 0;
-}
-
-void Shapes::insertionSort(edgeTableTuple *ett)
+static uint32_t isqrt(uint64_t v)
 {
-    int i, j;
-    EdgeBucket temp;
-
-    for (i = 1; i < ett->countEdgeBucket; i++)
+    uint64_t r = 0, bit = (uint64_t)1 << 62;
+    while (bit > v)
+        bit >>= 2;
+    while (bit)
     {
-        temp.ymax = ett->buckets[i].ymax;
-        temp.xofymin = ett->buckets[i].xofymin;
-        temp.slopeinverse = ett->buckets[i].slopeinverse;
-        j = i - 1;
-
-        while ((temp.xofymin < ett->buckets[j].xofymin) && (j >= 0))
+        if (v >= r + bit)
         {
-            ett->buckets[j + 1].ymax = ett->buckets[j].ymax;
-            ett->buckets[j + 1].xofymin = ett->buckets[j].xofymin;
-            ett->buckets[j + 1].slopeinverse = ett->buckets[j].slopeinverse;
-            j = j - 1;
+            v -= r + bit;
+            r = (r >> 1) + bit;
         }
-        ett->buckets[j + 1].ymax = temp.ymax;
-        ett->buckets[j + 1].xofymin = temp.xofymin;
-        ett->buckets[j + 1].slopeinverse = temp.slopeinverse;
+        else
+            r >>= 1;
+        bit >>= 2;
     }
+    return (uint32_t)r;
 }
 
-void Shapes::storeEdgeInTuple(edgeTableTuple *receiver, int ym, int xm, float slopInv)
+// to nearest, halves toward zero
+static int32_t divideRounded(int64_t a, int64_t b)
 {
-    (receiver->buckets[(receiver)->countEdgeBucket]).ymax = ym;
-    (receiver->buckets[(receiver)->countEdgeBucket]).xofymin = (float)xm;
-    (receiver->buckets[(receiver)->countEdgeBucket]).slopeinverse = slopInv;
-
-    insertionSort(receiver);
-
-    (receiver->countEdgeBucket)++;
+    return a >= 0 ? (2 * a + b - 1) / (2 * b) : -((-2 * a + b - 1) / (2 * b));
 }
 
-void Shapes::storeEdgeInTable(int x1, int y1, int x2, int y2)
+// the rectangle around the line as two triangles, its corners offset from the ends by half the thickness
+// along the normal: half thickness and length in 16.16 fixed point, the length by integer square root
+void Shapes::drawThickLine(int x1, int y1, int x2, int y2, int color, float thickness)
 {
-    float m, minv;
-    int ymaxTS, xwithyminTS, scanline; // ts stands for "to store"
-
-    if (x2 == x1)
+    int dx = x2 - x1, dy = y2 - y1;
+    if (dx == 0 && dy == 0)
+        dx = 1;
+
+    const int64_t half = (int64_t)(thickness * 32768.0f + (thickness < 0 ? -0.5f : 0.5f));
+    const int64_t length = isqrt(((uint64_t)((int64_t)dx * dx + (int64_t)dy * dy)) << 32);
+    // halves toward the line, so an odd thickness gives as many rows or columns as the angle based version
+    const int ox = divideRounded(-half * dy, length), oy = divideRounded(half * dx, length);
+    const int xa1 = x1 + ox, ya1 = y1 + oy, xa2 = x2 + ox, ya2 = y2 + oy;
+    const int xb1 = x1 - ox, yb1 = y1 - oy, xb2 = x2 - ox, yb2 = y2 - oy;
+
+    const int ax = ox < 0 ? -ox : ox, ay = oy < 0 ? -oy : oy;
+    if (clipRejects((x1 < x2 ? x1 : x2) - ax, (y1 < y2 ? y1 : y2) - ay, (x1 < x2 ? x2 : x1) + ax,
+                    (y1 < y2 ? y2 : y1) + ay))
+        return;
+
+    // the same diagonal as the angle based version, for the same pixels
+    if (dx == 0 ? dy > 0 : (dy != 0 && (dx < 0) != (dy < 0)))
     {
-        minv = 0.000000;
+        fillTriangle(xb1, yb1, xb2, yb2, xa1, ya1, color);
+        fillTriangle(xb2, yb2, xa2, ya2, xa1, ya1, color);
     }
     else
     {
-        m = ((float)(y2 - y1)) / ((float)(x2 - x1));
-
-        if (y2 == y1)
-            return;
-
-        minv = (float)1.0 / m;
-    }
-
-    if (y1 > y2)
-    {
-        scanline = y2;
-        ymaxTS = y1;
-        xwithyminTS = x2;
+        fillTriangle(xa1, ya1, xa2, ya2, xb1, yb1, color);
+        fillTriangle(xa2, ya2, xb2, yb2, xb1, yb1, color);
     }
-    else
-    {
-        scanline = y1;
-        ymaxTS = y2;
-        xwithyminTS = x1;
-    }
-    storeEdgeInTuple(&edgeTable[scanline], ymaxTS, xwithyminTS, minv);
 }
 
-void Shapes::removeEdgeByYmax(edgeTableTuple *tup, int yy)
-{
-    int i, j;
-    for (i = 0; i < tup->countEdgeBucket; i++)
-    {
-        if (tup->buckets[i].ymax == yy)
-        {
-            for (j = i; j < tup->countEdgeBucket - 1; j++)
-            {
-                tup->buckets[j].ymax = tup->buckets[j + 1].ymax;
-                tup->buckets[j].xofymin = tup->buckets[j + 1].xofymin;
-                tup->buckets[j].slopeinverse = tup->buckets[j + 1].slopeinverse;
-            }
-            tup->countEdgeBucket--;
-            i--;
-        }
-    }
-}
-
-void Shapes::updatexbyslopeinv(edgeTableTuple *tup)
-{
-    int i;
-
-    for (i = 0; i < tup->countEdgeBucket; i++)
-    {
-        (tup->buckets[i]).xofymin = (tup->buckets[i]).xofymin + (tup->buckets[i]).slopeinverse;
-    }
-}
-
-void Shapes::scanlineFill(uint8_t c)
+// segment i runs between the points i / n and (i + 1) / n of the way along, exactly in integers
+void Shapes::drawGradientLine(int x1, int y1, int x2, int y2, int color1, int color2, float thickness)
 {
-    int i, j, x1, ymax1, x2, ymax2, FillFlag = 0, coordCount;
+    const int n = color2 - color1, dx = x2 - x1, dy = y2 - y1;
+    const bool thin = fabsf(thickness + 1) < 0.1f;
 
-    for (i = 0; i < maxHt; i++)
+    for (int i = 0; i < n; ++i)
     {
-        for (j = 0; j < edgeTable[i].countEdgeBucket; j++)
-            storeEdgeInTuple(&activeEdgeTuple, edgeTable[i].buckets[j].ymax, edgeTable[i].buckets[j].xofymin,
-                             edgeTable[i].buckets[j].slopeinverse);
-
-        removeEdgeByYmax(&activeEdgeTuple, i);
-        insertionSort(&activeEdgeTuple);
-
-        j = 0;
-        FillFlag = 0;
-        coordCount = 0;
-        x1 = 0;
-        x2 = 0;
-        ymax1 = 0;
-        ymax2 = 0;
-        while (j < activeEdgeTuple.countEdgeBucket)
-        {
-            if (coordCount % 2 == 0)
-            {
-                x1 = (int)(activeEdgeTuple.buckets[j].xofymin);
-                ymax1 = activeEdgeTuple.buckets[j].ymax;
-                if (x1 == x2)
-                {
-                    if (((x1 == ymax1) && (x2 != ymax2)) || ((x1 != ymax1) && (x2 == ymax2)))
-                    {
-                        x2 = x1;
-                        ymax2 = ymax1;
-                    }
-
-                    else
-                    {
-                        coordCount++;
-                    }
-                }
-                else
-                {
-                    coordCount++;
-                }
-            }
-            else
-            {
-                x2 = (int)activeEdgeTuple.buckets[j].xofymin;
-                ymax2 = activeEdgeTuple.buckets[j].ymax;
-
-                FillFlag = 0;
-                if (x1 == x2)
-                {
-                    if (((x1 == ymax1) && (x2 != ymax2)) || ((x1 != ymax1) && (x2 == ymax2)))
-                    {
-                        x1 = x2;
-                        ymax1 = ymax2;
-                    }
-                    else
-                    {
-                        coordCount++;
-                        FillFlag = 1;
-                    }
-                }
-                else
-                {
-                    coordCount++;
-                    FillFlag = 1;
-                }
-
-                if (FillFlag)
-                {
-                    drawLine(x1, i, x2, i, c);
-                }
-            }
-
-            j++;
-        }
-        updatexbyslopeinv(&activeEdgeTuple);
+        const int xa = (x1 * n + i * dx) / n, ya = (y1 * n + i * dy) / n;
+        const int xb = (x1 * n + (i + 1) * dx) / n, yb = (y1 * n + (i + 1) * dy) / n;
+        if (thin)
+            drawLine(xa, ya, xb, yb, color1 + i);
+        else
+            drawThickLine(xa, ya, xb, yb, color1 + i, thickness);
     }
 }
 
@@ -324,36 +168,116 @@ void Shapes::drawPolygon(int *x, int *y, int n, int color)
         drawLine(x[i], y[i], x[(i + 1) % n], y[(i + 1) % n], color);
 }
 
+// active edge table fill (even-odd) with edges from a fixed pool of at most maxVer, advanced in fixed point
+// a scanline at a time and kept sorted by x, each span written as one horizontal line; then the outline.
+// Polygons outside the clip are rejected by their bounding box, and only scanlines within it are walked.
+// Polygons of more than maxVer vertices are not drawn
 void Shapes::fillPolygon(int *x, int *y, int n, int color)
 {
-    edgeTable = (edgeTableTuple *)ps_malloc(maxHt * sizeof(edgeTableTuple));
-    initedgeTable();
+    if (n > maxVer)
+    {
+#ifdef DEBUG
+        Serial.printf("fillPolygon: %d vertices, more than the %d it fills\n", n, maxVer);
+#endif
+        return;
+    }
+    if (n < 3)
+        return;
+
+    int xmin = x[0], xmax = x[0], ymin = y[0], ymax = y[0];
+    for (int i = 1; i < n; i++)
+    {
+        xmin = x[i] < xmin ? x[i] : xmin;
+        xmax = x[i] > xmax ? x[i] : xmax;
+        ymin = y[i] < ymin ? y[i] : ymin;
+        ymax = y[i] > ymax ? y[i] : ymax;
+    }
+    if (clipRejects(xmin, ymin, xmax, ymax))
+        return;
 
-    int count = 0, x1 = 0, y1 = 0, x2 = 0, y2 = 0;
+    PolygonEdge edges[maxVer];
+    int16_t active[maxVer];
+    int count = 0, ytop = INT16_MAX, ybottom = INT16_MIN;
 
-    for (int i = 0; i < n + 1; ++i)
+    for (int i = 0; i < n; i++)
     {
-        count++;
-        if (count > 2)
+        int x1 = x[i], y1 = y[i], x2 = x[(i + 1) % n], y2 = y[(i + 1) % n];
+        if (y1 == y2)
+            continue;
+        if (y1 > y2)
         {
+            int t = x1;
             x1 = x2;
+            x2 = t;
+            t = y1;
             y1 = y2;
-            count = 2;
+            y2 = t;
         }
-        if (count == 1)
+        PolygonEdge *edge = &edges[count++];
+        edge->ymin = y1;
+        edge->ymax = y2;
+        edge->x = (int32_t)x1 * 65536 + 32768;
+        edge->dx = (int32_t)(((int64_t)(x2 - x1) * 65536) / (y2 - y1));
+        if (y1 < ytop)
+            ytop = y1;
+        if (y2 > ybottom)
+            ybottom = y2;
+    }
+
+    // by ymin, so edges are taken on in order
+    for (int i = 1; i < count; i++)
+        for (int j = i; j > 0 && edges[j].ymin < edges[j - 1].ymin; j--)
         {
-            x1 = x[i % n];
-            y1 = y[i % n];
+            PolygonEdge t = edges[j];
+            edges[j] = edges[j - 1];
+            edges[j - 1] = t;
         }
-        else
+
+    // only the scanlines within the clip, edges starting above it are advanced to it when taken on
+    int16_t clipTop, clipBottom;
+    clipRows(&clipTop, &clipBottom);
+    if (ytop < clipTop)
+        ytop = clipTop;
+    if (ybottom > clipBottom + 1)
+        ybottom = clipBottom + 1;
+
+    startWrite();
+    int next = 0, actives = 0;
+    for (int yy = ytop; yy < ybottom; yy++)
+    {
+        while (next < count && edges[next].ymin <= yy)
         {
-            x2 = x[i % n];
-            y2 = y[i % n];
-            drawLine(x1, y1, x2, y2, color);
-            storeEdgeInTable(x1, y1, x2, y2);
+            if (edges[next].ymin < yy)
+                edges[next].x = (int32_t)(edges[next].x + (int64_t)edges[next].dx * (yy - edges[next].ymin));
+            active[actives++] = next++;
         }
+
+        int kept = 0;
+        for (int i = 0; i < actives; i++)
+            if (edges[active[i]].ymax > yy)
+                active[kept++] = active[i];
+        actives = kept;
+
+        // nearly sorted from the previous scanline
+        for (int i = 1; i < actives; i++)
+            for (int j = i; j > 0 && edges[active[j]].x < edges[active[j - 1]].x; j--)
+            {
+                int16_t t = active[j];
+                active[j] = active[j - 1];
+                active[j - 1] = t;
+            }
+
+        for (int i = 0; i + 1 < actives; i += 2)
+        {
+            const int xa = edges[active[i]].x >> 16, xb = edges[active[i + 1]].x >> 16;
+            if (xb >= xa)
+                writeFastHLine(xa, yy, xb - xa + 1, color);
+        }
+
+        for (int i = 0; i < actives; i++)
+            edges[active[i]].x += edges[active[i]].dx;
     }
-    scanlineFill(color);
-    free(edgeTable);
-}
+    endWrite();
 
+    drawPolygon(x, y, n, color);
+}
@@ -6,7 +6,6 @@
 #include "libs/Adafruit-GFX-Library/Adafruit_GFX.h"
 
 #define maxVer 100
-#define maxHt  E_INK_HEIGHT
 
 class Shapes : virtual public Adafruit_GFX
 {
@@ -23,27 +22,15 @@ class Shapes : virtual public Adafruit_GFX
     void drawGradientLine(int x1, int y1, int x2, int y2, int color1, int color2, float thickness = -1);
 
   private:
-    struct EdgeBucket
+    // polygon edge, top inclusive and bottom exclusive, x at the current scanline in 16.16 fixed point
+    struct PolygonEdge
     {
-        int ymax;
-        float xofymin;
-        float slopeinverse;
+        int16_t ymin, ymax;
+        int32_t x, dx;
     };
 
-    struct edgeTableTuple
-    {
-        int countEdgeBucket;
-        EdgeBucket buckets[maxVer];
-    };
-
-    void initedgeTable();
-    void insertionSort(edgeTableTuple *ett);
-    void storeEdgeInTuple(edgeTableTuple *receiver, int ym, int xm, float slopInv);
-    void storeEdgeInTable(int x1, int y1, int x2, int y2);
-    void removeEdgeByYmax(edgeTableTuple *tup, int yy);
-    void updatexbyslopeinv(edgeTableTuple *tup);
-    void scanlineFill(uint8_t c);
-
+    virtual bool clipRejects(int16_t x0, int16_t y0, int16_t x1, int16_t y1) = 0;
+    virtual void clipRows(int16_t *y0, int16_t *y1) = 0;
     virtual void startWrite(void) = 0;
     virtual void writePixel(int16_t x, int16_t y, uint16_t color) = 0;
     virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) = 0;
@@ -51,8 +38,6 @@ class Shapes : virtual public Adafruit_GFX
     virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) = 0;
     virtual void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) = 0;
     virtual void endWrite(void) = 0;
-
-    edgeTableTuple *edgeTable, activeEdgeTuple;
 };
 
 #endif
\ No newline at end of file
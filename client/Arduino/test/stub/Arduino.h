@@ -0,0 +1,93 @@
+#pragma once
+// host stand-in for the parts of the Arduino core (ESP32) used by the library and the sketch
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
+#include <string>
+#include <functional>
+#include <algorithm>
+#include <stdexcept>
+#ifndef ARDUINO
+#define ARDUINO 10819
+#endif
+#define ESP32 1
+#define PROGMEM
+#define RTC_DATA_ATTR
+#define RTC_NOINIT_ATTR
+#define RTC_IRAM_ATTR
+#define RTC_RODATA_ATTR
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+#define pgm_read_word(addr) (*(const unsigned short *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define HIGH 1
+#define LOW 0
+#define INPUT 1
+#define OUTPUT 3
+#define INPUT_PULLUP 5
+#define MSBFIRST 1
+#define SPI_MODE0 0
+#define M_PI_2 1.57079632679489661923
+typedef int esp_err_t;
+#define ESP_OK 0
+class __FlashStringHelper;
+class String {
+    std::string s;
+public:
+    String () {}
+    String (const char *c): s (c ? c : "") {}
+    String (const std::string &c): s (c) {}
+    explicit String (int v): s (std::to_string (v)) {}
+    explicit String (unsigned v): s (std::to_string (v)) {}
+    explicit String (long v): s (std::to_string (v)) {}
+    explicit String (unsigned long v): s (std::to_string (v)) {}
+    explicit String (float v, unsigned d = 2) { char b[32]; snprintf (b, sizeof b, "%.*f", d, v); s = b; }
+    explicit String (double v, unsigned d = 2) { char b[32]; snprintf (b, sizeof b, "%.*f", d, v); s = b; }
+    const char *c_str () const { return s.c_str (); }
+    bool isEmpty () const { return s.empty (); }
+    unsigned length () const { return s.size (); }
+    long toInt () const { return atol (s.c_str ()); }
+    float toFloat () const { return atof (s.c_str ()); }
+    bool startsWith (const String &o) const { return s.rfind (o.s, 0) == 0; }
+    int indexOf (char c) const { auto p = s.find (c); return p == std::string::npos ? -1 : (int) p; }
+    int indexOf (char c, unsigned from) const { auto p = s.find (c, from); return p == std::string::npos ? -1 : (int) p; }
+    String substring (unsigned a, unsigned b) const { return s.substr (a, b - a); }
+    String substring (unsigned a) const { return s.substr (a); }
+    char operator [] (unsigned i) const { return s [i]; }
+    String &operator+= (const String &o) { s += o.s; return *this; }
+    String &operator+= (const char *o) { s += o; return *this; }
+    String &operator+= (char o) { s += o; return *this; }
+    friend String operator+ (const String &a, const String &b) { return a.s + b.s; }
+    friend String operator+ (const String &a, const char *b) { return a.s + b; }
+    friend String operator+ (const char *a, const String &b) { return a + b.s; }
+    bool operator== (const String &o) const { return s == o.s; }
+    bool operator== (const char *o) const { return s == o; }
+    bool operator!= (const String &o) const { return s != o.s; }
+    bool operator!= (const char *o) const { return s != o; }
+    bool operator< (const String &o) const { return s < o.s; }
+};
+class Print {
+public:
+    virtual size_t write (uint8_t) = 0;
+    virtual size_t write (const uint8_t *b, size_t n) { for (size_t i = 0; i < n; i++) write (b[i]); return n; }
+    size_t write (const char *s) { return write ((const uint8_t *) s, strlen (s)); }
+    size_t print (const char *s) { return write (s); }
+    size_t print (const String &s) { return write (s.c_str ()); }
+    size_t printf (const char *, ...) { return 0; }
+};
+struct SerialStub { void begin (int) {} void flush () {} void end () {} int printf (const char *f, ...) { return 0; } };
+extern SerialStub Serial;
+unsigned long millis (); unsigned long micros (); void delay (uint32_t); void delayMicroseconds (uint32_t);
+int digitalRead (uint8_t); void digitalWrite (uint8_t, uint8_t); void pinMode (uint8_t, uint8_t);
+uint32_t analogReadMilliVolts (uint8_t); uint16_t analogRead (uint8_t);
+char *dtostrf (double, signed char, unsigned char, char *);
+bool setCpuFrequencyMhz (uint32_t); uint32_t getCpuFrequencyMhz ();
+typedef enum { ESP_MAC_WIFI_STA } esp_mac_type_t;
+esp_err_t esp_read_mac (uint8_t *, esp_mac_type_t);
+struct EspClass { void restart (); uint32_t getCpuFreqMHz (); };
+extern EspClass ESP;
+#include "esp_sleep.h"
+#include "esp_system.h"
@@ -0,0 +1,15 @@
+#pragma once
+#include "Arduino.h"
+#include <map>
+struct JsonPair; struct JsonObjectConst; struct JsonArrayConst;
+struct JsonString { const char *c_str () const { return ""; } };
+struct JsonVariantConst { template <typename T> bool is () const { return false; } template <typename T> T as () const { return T (); } template <typename T> bool is () { return false; }
+  JsonVariantConst operator [] (const char *) const { return {}; } };
+struct JsonVariant: JsonVariantConst {};
+struct JsonPairConst { JsonString key () const { return {}; } JsonVariantConst value () const { return {}; } };
+struct JsonObjectConst { const JsonPairConst *begin () const { return nullptr; } const JsonPairConst *end () const { return nullptr; } };
+struct JsonArrayConst { const JsonVariantConst *begin () const { return nullptr; } const JsonVariantConst *end () const { return nullptr; } };
+struct JsonDocument { template <typename T> T as () const { return T (); } JsonVariantConst operator [] (const char *) const { return {}; } };
+struct DeserializationError { operator bool () const { return false; } const char *c_str () const { return ""; } };
+template <typename S> DeserializationError deserializeJson (JsonDocument &, S &&) { return {}; }
+size_t serializeJson (const JsonDocument &, String &);
@@ -0,0 +1,4 @@
+#pragma once
+// the sketch keeps its credentials out of the tree, these stand in for them
+#define DEFAULT_NETWORK_SSID "ssid"
+#define DEFAULT_NETWORK_PASS "pass"
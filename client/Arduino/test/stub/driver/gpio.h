@@ -0,0 +1,7 @@
+#pragma once
+#include <stdint.h>
+typedef int gpio_num_t;
+int gpio_set_level(gpio_num_t, uint32_t);
+typedef enum { GPIO_INTR_LOW_LEVEL = 4, GPIO_INTR_HIGH_LEVEL = 5 } gpio_int_type_t;
+int gpio_wakeup_enable(gpio_num_t, gpio_int_type_t);
+int gpio_wakeup_disable(gpio_num_t);
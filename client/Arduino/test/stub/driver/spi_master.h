@@ -0,0 +1,22 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+typedef int esp_err_t;
+#define ESP_OK 0
+#define SPI3_HOST 2
+#define SPI_DMA_CH_AUTO 3
+#define SPI_TRANS_USE_TXDATA (1 << 3)
+#define portMAX_DELAY 0xFFFFFFFF
+#define IRAM_ATTR
+typedef int spi_host_device_t;
+typedef struct spi_transaction_t { uint32_t flags; uint16_t cmd; uint64_t addr; size_t length, rxlength; void *user; union { const void *tx_buffer; uint8_t tx_data[4]; }; union { void *rx_buffer; uint8_t rx_data[4]; }; } spi_transaction_t;
+typedef void (*transaction_cb_t)(spi_transaction_t *);
+typedef struct { int mosi_io_num, miso_io_num, sclk_io_num, quadwp_io_num, quadhd_io_num; int max_transfer_sz; uint32_t flags; int intr_flags; } spi_bus_config_t;
+typedef struct { uint8_t command_bits, address_bits, dummy_bits, mode; uint16_t duty_cycle_pos, cs_ena_pretrans; uint8_t cs_ena_posttrans; int clock_speed_hz; int input_delay_ns; int spics_io_num; uint32_t flags; int queue_size; transaction_cb_t pre_cb, post_cb; } spi_device_interface_config_t;
+typedef struct spi_device_t *spi_device_handle_t;
+esp_err_t spi_bus_initialize(spi_host_device_t, const spi_bus_config_t *, int);
+esp_err_t spi_bus_free(spi_host_device_t);
+esp_err_t spi_bus_add_device(spi_host_device_t, const spi_device_interface_config_t *, spi_device_handle_t *);
+esp_err_t spi_bus_remove_device(spi_device_handle_t);
+esp_err_t spi_device_queue_trans(spi_device_handle_t, spi_transaction_t *, uint32_t);
+esp_err_t spi_device_get_trans_result(spi_device_handle_t, spi_transaction_t **, uint32_t);
@@ -0,0 +1,5 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#define MALLOC_CAP_DMA (1 << 3)
+void *heap_caps_malloc (size_t, uint32_t);
@@ -0,0 +1,14 @@
+#pragma once
+#include <cstdint>
+typedef int esp_err_t;
+typedef enum { ESP_SLEEP_WAKEUP_UNDEFINED, ESP_SLEEP_WAKEUP_TIMER, ESP_SLEEP_WAKEUP_GPIO } esp_sleep_wakeup_cause_t;
+esp_err_t esp_sleep_enable_timer_wakeup (uint64_t);
+esp_err_t esp_sleep_enable_gpio_wakeup ();
+esp_err_t esp_sleep_disable_wakeup_source (int);
+#define ESP_SLEEP_WAKEUP_ALL 0
+void esp_deep_sleep_start ();
+esp_err_t esp_light_sleep_start ();
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause ();
+void esp_default_wake_deep_sleep ();
+typedef void (*esp_deep_sleep_wake_stub_fn_t) (void);
+void esp_set_deep_sleep_wake_stub (esp_deep_sleep_wake_stub_fn_t);
@@ -0,0 +1,10 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+typedef uint32_t nvs_handle_t; typedef int esp_err_t;
+enum { NVS_READWRITE };
+esp_err_t nvs_flash_init (); esp_err_t nvs_flash_init_partition (const char *); esp_err_t nvs_flash_erase_partition (const char *);
+esp_err_t nvs_open_from_partition (const char *, const char *, int, nvs_handle_t *); void nvs_close (nvs_handle_t);
+esp_err_t nvs_get_u32 (nvs_handle_t, const char *, uint32_t *); esp_err_t nvs_set_u32 (nvs_handle_t, const char *, uint32_t);
+esp_err_t nvs_get_i32 (nvs_handle_t, const char *, int32_t *); esp_err_t nvs_set_i32 (nvs_handle_t, const char *, int32_t);
+esp_err_t nvs_get_str (nvs_handle_t, const char *, char *, size_t *); esp_err_t nvs_set_str (nvs_handle_t, const char *, const char *);
@@ -0,0 +1,110 @@
+// host implementations of the stubbed Arduino core and ESP-IDF functions
+#include <chrono>
+#include <deque>
+#include "Arduino.h"
+#include "esp_heap_caps.h"
+#include "nvs_flash.h"
+#include "driver/gpio.h"
+#include "stub.h"
+
+SerialStub Serial;
+EspClass ESP;
+
+static const auto started = std::chrono::steady_clock::now();
+unsigned long millis() { return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started).count(); }
+unsigned long micros() { return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started).count(); }
+void delay(uint32_t) {}
+void delayMicroseconds(uint32_t) {}
+
+int digitalRead(uint8_t) { return stub::level; }
+void digitalWrite(uint8_t, uint8_t) {}
+void pinMode(uint8_t, uint8_t) {}
+
+void *heap_caps_malloc(size_t n, uint32_t) { return malloc(n); }
+char *dtostrf(double v, signed char w, unsigned char p, char *b)
+{
+    sprintf(b, "%*.*f", w, p, v);
+    return b;
+}
+esp_err_t esp_read_mac(uint8_t *mac, esp_mac_type_t)
+{
+    memset(mac, 0, 6);
+    return ESP_OK;
+}
+
+namespace stub
+{
+std::vector<std::pair<int, int>> wire;
+spi_device_interface_config_t device;
+bool added;
+int outstanding, peak, failures;
+int level = 1;
+bool panel;
+static std::deque<spi_transaction_t *> pending;
+static int dc;
+void reset()
+{
+    wire.clear();
+    pending.clear();
+    added = false;
+    outstanding = peak = failures = 0;
+    level = 1;
+    panel = false;
+}
+} // namespace stub
+
+int gpio_set_level(gpio_num_t, uint32_t level)
+{
+    stub::dc = level;
+    return 0;
+}
+int gpio_wakeup_enable(gpio_num_t, gpio_int_type_t) { return 0; }
+int gpio_wakeup_disable(gpio_num_t) { return 0; }
+
+esp_err_t spi_bus_initialize(spi_host_device_t, const spi_bus_config_t *, int) { return ESP_OK; }
+esp_err_t spi_bus_free(spi_host_device_t) { return ESP_OK; }
+esp_err_t spi_bus_add_device(spi_host_device_t, const spi_device_interface_config_t *config, spi_device_handle_t *handle)
+{
+    if (stub::added)
+        stub::failures++;
+    stub::added = true;
+    stub::device = *config;
+    *handle = (spi_device_handle_t)1;
+    return ESP_OK;
+}
+esp_err_t spi_bus_remove_device(spi_device_handle_t)
+{
+    if (stub::outstanding)
+        stub::failures++;
+    stub::added = false;
+    return ESP_OK;
+}
+esp_err_t spi_device_queue_trans(spi_device_handle_t, spi_transaction_t *transaction, uint32_t)
+{
+    if (stub::outstanding >= stub::device.queue_size)
+        stub::failures++;
+    stub::pending.push_back(transaction);
+    if (++stub::outstanding > stub::peak)
+        stub::peak = stub::outstanding;
+    return ESP_OK;
+}
+esp_err_t spi_device_get_trans_result(spi_device_handle_t, spi_transaction_t **transaction, uint32_t)
+{
+    if (stub::pending.empty())
+    {
+        stub::failures++;
+        return -1;
+    }
+    spi_transaction_t *_t = stub::pending.front();
+    stub::pending.pop_front();
+    if (stub::device.pre_cb != NULL)
+        stub::device.pre_cb(_t);
+    const uint8_t *_bytes = (_t->flags & SPI_TRANS_USE_TXDATA) ? _t->tx_data : (const uint8_t *)_t->tx_buffer;
+    for (size_t i = 0; i < _t->length / 8; i++)
+        stub::wire.push_back({stub::dc, _bytes[i]});
+    if (stub::panel && stub::dc == 0 && (_bytes[0] == 0x04 || _bytes[0] == 0x12 || _bytes[0] == 0x02))
+        stub::level = 0;
+    stub::outstanding--;
+    *transaction = _t;
+    return ESP_OK;
+}
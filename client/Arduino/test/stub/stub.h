@@ -0,0 +1,20 @@
+#pragma once
+// what the stubs record, for the checks to inspect
+#include <vector>
+#include <utility>
+#include "driver/spi_master.h"
+
+namespace stub
+{
+// spi_master: transactions complete in order as their results are collected, each byte kept with the DC level
+// at the time (0 command, 1 data)
+extern std::vector<std::pair<int, int>> wire;
+extern spi_device_interface_config_t device;
+extern bool added;
+extern int outstanding, peak, failures;
+// what digitalRead returns: the panel's busy line, high when it is not busy; with panel set, it goes low as the
+// panel is sent each command it works on (power on, refresh, power off) until a check raises it again
+extern int level;
+extern bool panel;
+void reset();
+} // namespace stub
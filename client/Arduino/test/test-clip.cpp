@@ -0,0 +1,187 @@
+// Graphics' clip stack against masking: every primitive drawn under a clip, or two nested, at every rotation over
+// a random frame must leave the frame as the unclipped draw within the clip and untouched outside it; the bounds
+// are clipped too; then a drawing mostly outside the clip is timed against the same unclipped
+#include <chrono>
+#include <random>
+#include "Inkplate.h"
+#include "Fonts.hpp"
+#include "Glyphs.hpp"
+
+static const int frame = E_INK_WIDTH * E_INK_HEIGHT / 4, primitives = 14;
+
+// a primitive placed around x, y
+static void draw(Inkplate &view, std::mt19937 &rng, int primitive, int x, int y)
+{
+    x += (int)(rng() % 40) - 20;
+    y += (int)(rng() % 40) - 20;
+    const int w = rng() % 80, h = rng() % 80, c = rng() % 3;
+    switch (primitive)
+    {
+    case 0:
+        view.fillRect(x, y, w, h, c);
+        break;
+    case 1:
+        view.drawLine(x, y, x + w - 40, y + h - 40, c);
+        break;
+    case 2:
+        view.drawCircle(x, y, w / 2, c);
+        break;
+    case 3:
+        view.fillCircle(x, y, w / 2, c);
+        break;
+    case 4:
+        view.fillTriangle(x, y, x + w, y + 10, x + 5, y + h, c);
+        break;
+    case 5:
+        view.drawElipse(w / 2 + 1, h / 3 + 1, x, y, c);
+        break;
+    case 6:
+        view.fillElipse(w / 2 + 1, h / 3 + 1, x, y, c);
+        break;
+    case 7: {
+        int px[5] = {x, x + w, x + w / 2, x + 3, x - 10}, py[5] = {y, y + 5, y + h, y + h / 2, y + 20};
+        view.fillPolygon(px, py, 5, c);
+        break;
+    }
+    case 8:
+        view.drawThickLine(x, y, x + w - 40, y + h - 40, c, 1 + (rng() % 5));
+        break;
+    case 9: {
+        const bool large = rng() % 2;
+        view.setFont(large ? &FreeSansBold9pt7b : &Org_01);
+        view.setTextColor(c);
+        view.setCursor(x, y);
+        view.print(large ? "-12.5" : "hPa");
+        break;
+    }
+    case 10:
+        view.drawRoundRect(x, y, w, h, 5, c);
+        break;
+    case 11:
+        view.drawRect(x, y, w, h, c);
+        break;
+    case 12:
+        view.fillRoundRect(x, y, w, h, 5, c);
+        break;
+    case 13: {
+        // reaching far off the screen, the edges taken on many scanlines below their tops
+        int px[3] = {x - 20000, x + 20000, x + w}, py[3] = {y - 30000, y + h, y + 30000};
+        view.fillPolygon(px, py, 3, c);
+        break;
+    }
+    }
+}
+
+static void physical(int r, int x, int y, int *px, int *py)
+{
+    *px = r == 0 ? E_INK_WIDTH - 1 - x : r == 1 ? y : r == 2 ? x : E_INK_WIDTH - 1 - y;
+    *py = r == 0 ? E_INK_HEIGHT - 1 - y : r == 1 ? E_INK_HEIGHT - 1 - x : r == 2 ? y : x;
+}
+
+int main()
+{
+    Inkplate a, b;
+    a.begin();
+    b.begin();
+    a.setGlyphCache(DEFAULT_GLYPHS, sizeof(DEFAULT_GLYPHS) / sizeof(DEFAULT_GLYPHS[0]));
+    b.setGlyphCache(DEFAULT_GLYPHS, sizeof(DEFAULT_GLYPHS) / sizeof(DEFAULT_GLYPHS[0]));
+    a.setTextWrap(false);
+    b.setTextWrap(false);
+
+    std::mt19937 rng(11);
+    static uint8_t base[frame];
+    int bad = 0, rejected = 0;
+    for (int r = 0; r < 4; r++)
+    {
+        a.setRotation(r);
+        b.setRotation(r);
+        for (int t = 0; t < 14000; t++)
+        {
+            for (auto &byte : base)
+                byte = rng();
+            memcpy(a.DMemory4Bit, base, frame);
+            memcpy(b.DMemory4Bit, base, frame);
+            const int cx = (int)(rng() % (a.width() + 20)) - 20, cy = (int)(rng() % (a.height() + 20)) - 20,
+                      cw = rng() % 120, ch = rng() % 120;
+            const int dx = cx + (int)(rng() % 40) - 20, dy = cy + (int)(rng() % 40) - 20, dw = rng() % 120,
+                      dh = rng() % 120;
+            const bool nested = t & 1;
+            const int primitive = (t / 2) % primitives;
+            const uint32_t seed = rng();
+            std::mt19937 ra(seed), rb(seed);
+
+            draw(a, ra, primitive, cx, cy);
+            b.pushClip(cx, cy, cw, ch);
+            if (nested)
+                b.pushClip(dx, dy, dw, dh);
+            draw(b, rb, primitive, cx, cy);
+            if (nested)
+                b.popClip();
+            b.popClip();
+
+            int x0 = cx, y0 = cy, x1 = cx + cw - 1, y1 = cy + ch - 1;
+            if (nested)
+            {
+                x0 = x0 > dx ? x0 : dx;
+                y0 = y0 > dy ? y0 : dy;
+                x1 = x1 < dx + dw - 1 ? x1 : dx + dw - 1;
+                y1 = y1 < dy + dh - 1 ? y1 : dy + dh - 1;
+            }
+            bool same = true;
+            for (int y = 0; y < a.height() && same; y++)
+                for (int x = 0; x < a.width() && same; x++)
+                {
+                    int px, py;
+                    physical(r, x, y, &px, &py);
+                    const int offset = 13 * py + px / 8;
+                    const uint8_t mask = 0x80 >> (px & 7);
+                    const uint8_t *want = x >= x0 && x <= x1 && y >= y0 && y <= y1 ? a.DMemory4Bit : base;
+                    for (int p = 0; p < 2; p++)
+                        if ((b.DMemory4Bit[2756 * p + offset] ^ want[2756 * p + offset]) & mask)
+                            same = false;
+                }
+            rejected += memcmp(b.DMemory4Bit, base, frame) == 0;
+            if (!same)
+            {
+                printf("rotation %d, case %d, primitive %d%s differs from the masked draw\n", r, t, primitive,
+                       nested ? " nested" : "");
+                if (++bad > 5)
+                    return 1;
+            }
+        }
+    }
+    printf("56000 clipped draws, %d left nothing: %s\n", rejected, bad ? "FAIL" : "OK");
+
+    int16_t x0, y0, x1, y1;
+    a.setRotation(1);
+    a.pushClip(10, 10, 50, 20);
+    a.beginBounds(true);
+    a.fillRect(0, 0, 100, 100, 1);
+    a.endBounds(&x0, &y0, &x1, &y1);
+    a.popClip();
+    const bool bounded = x0 == 10 && y0 == 10 && x1 == 59 && y1 == 29;
+    printf("bounds %d,%d to %d,%d: %s\n", x0, y0, x1, y1, bounded ? "OK" : "FAIL");
+    bad += !bounded;
+
+    a.setFont(&FreeSansBold9pt7b);
+    const auto run = [&] {
+        a.fillElipse(40, 20, 150, 60, 1);
+        a.drawLine(0, 0, 211, 103, 2);
+        a.setCursor(120, 80);
+        a.print("1013");
+        a.drawCircle(160, 50, 30, 1);
+    };
+    const int k = 100000;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < k; i++)
+        run();
+    const auto t1 = std::chrono::steady_clock::now();
+    a.pushClip(0, 0, 100, 40);
+    for (int i = 0; i < k; i++)
+        run();
+    a.popClip();
+    const auto t2 = std::chrono::steady_clock::now();
+    const auto us = [&](std::chrono::steady_clock::duration d) { return std::chrono::duration<double, std::micro>(d).count() / k; };
+    printf("unclipped %.2f us, clipped to 0,0 to 99,39 %.2f us\n", us(t1 - t0), us(t2 - t1));
+    return bad ? 1 : 0;
+}
@@ -0,0 +1,138 @@
+// DisplayList::show, run as a sequence of wakes, against every renderer drawn over the base frame: values change,
+// appear and go, so the red crosses drawn over the icons come and go, and the retained frame redrawn within the
+// damage must match the full draw after every wake; and first Inkplate::restoreClip, which takes the damage back
+// from the base frame, against a per-pixel copy at every rotation
+#include <random>
+#include "Inkplate.h"
+#include "Common.hpp"
+#include "Secrets.hpp"
+#include "Config.hpp"
+#include "Render.hpp"
+
+static void draw(Inkplate &view, const Variables &vars)
+{
+    memcpy(view.DMemory4Bit, DEFAULT_BASE_FRAME, sizeof(DEFAULT_BASE_FRAME));
+    for (const auto *renderer : renderers_default)
+        renderer->render(view);
+    for (const auto &entry : renderers_byvalue)
+    {
+        const auto search = vars.find(entry.name);
+        if (search != vars.end())
+            entry.renderer->render(view, search->second, vars);
+        else
+            entry.renderer->render(view);
+    }
+}
+
+static String value(std::mt19937 &rng, const String &name)
+{
+    const char *_name = name.c_str();
+    if (strstr(_name, "__checks") != NULL)
+        return "1";
+    if (strstr(_name, "_batt") != NULL)
+        return String(1.0f + (float)(rng() % 100) / 100.0f, 2);
+    if (strstr(_name, "barom") != NULL)
+        return String(950.0f + (float)(rng() % 1000) / 10.0f, 1);
+    if (strstr(_name, "humidity") != NULL)
+        return String((float)(rng() % 1000) / 10.0f, 1);
+    return String(-25.0f + (float)(rng() % 600) / 10.0f, 1);
+}
+
+static bool restored(Inkplate &view, std::mt19937 &rng)
+{
+    static uint8_t base[E_INK_WIDTH * E_INK_HEIGHT / 4], before[E_INK_WIDTH * E_INK_HEIGHT / 4];
+    for (int r = 0; r < 4; r++)
+    {
+        view.setRotation(r);
+        for (int t = 0; t < 5000; t++)
+        {
+            for (auto &byte : base)
+                byte = rng();
+            for (auto &byte : before)
+                byte = rng();
+            memcpy(view.DMemory4Bit, before, sizeof(before));
+            const int x = (int)(rng() % 240) - 20, y = (int)(rng() % 240) - 20, w = rng() % 120, h = rng() % 120;
+            view.pushClip(x, y, w, h);
+            view.restoreClip(base);
+            view.popClip();
+            for (int yy = 0; yy < view.height(); yy++)
+                for (int xx = 0; xx < view.width(); xx++)
+                {
+                    const int px = r == 0 ? 103 - xx : r == 1 ? yy : r == 2 ? xx : 103 - yy,
+                              py = r == 0 ? 211 - yy : r == 1 ? 211 - xx : r == 2 ? yy : xx;
+                    const int offset = 13 * py + px / 8;
+                    const uint8_t mask = 0x80 >> (px & 7);
+                    const uint8_t *want = xx >= x && xx < x + w && yy >= y && yy < y + h ? base : before;
+                    for (int p = 0; p < 2; p++)
+                        if ((view.DMemory4Bit[2756 * p + offset] ^ want[2756 * p + offset]) & mask)
+                        {
+                            printf("restoreClip: rotation %d, clip %d,%d %dx%d differs at %d,%d\n", r, x, y, w, h, xx, yy);
+                            return false;
+                        }
+                }
+        }
+    }
+    view.setRotation(1);
+    return true;
+}
+
+int main()
+{
+    Inkplate a, b;
+    a.begin(DEFAULT_BASE_FRAME);
+    b.begin(DEFAULT_BASE_FRAME);
+    a.setGlyphCache(DEFAULT_GLYPHS, sizeof(DEFAULT_GLYPHS) / sizeof(DEFAULT_GLYPHS[0]));
+    b.setGlyphCache(DEFAULT_GLYPHS, sizeof(DEFAULT_GLYPHS) / sizeof(DEFAULT_GLYPHS[0]));
+    a.setTextWrap(false);
+    b.setTextWrap(false);
+
+    std::vector<String> names = {"house/__checks[0]", "house/__checks[1]", "house/__checks[2]", "outside/__checks[0]",
+                                 "outside/__checks[1]", "outside/__checks[2]"};
+    for (const auto &entry : renderers_byvalue)
+        if (std::find(names.begin(), names.end(), entry.name) == names.end())
+            names.push_back(entry.name);
+
+    std::mt19937 rng(17);
+    if (!restored(a, rng))
+        return 1;
+    printf("restoreClip: OK\n");
+
+    Variables vars;
+    for (const auto &name : names)
+        vars[name] = value(rng, name);
+
+    int bad = 0, crosses = 0;
+    const int wakes = 2000;
+    for (int wake = 0; wake < wakes; wake++)
+    {
+        // a few values change each wake, some go missing and come back
+        for (int change = rng() % 4; change >= 0; change--)
+        {
+            const String &name = names[rng() % names.size()];
+            if (vars.find(name) != vars.end() && rng() % 4 == 0)
+                vars.erase(name);
+            else
+                vars[name] = value(rng, name);
+        }
+        String faulty;
+        for (const auto &entry : renderers_byvalue)
+            if (dynamic_cast<const Renderer_Faulty *>(entry.renderer) != NULL)
+                faulty += vars.find(entry.name) != vars.end() ? entry.renderer->present(vars.at(entry.name), vars) : "x";
+        static String shown;
+        if (wake > 0 && faulty != shown)
+            crosses++;
+        shown = faulty;
+
+        memcpy(a.DMemory4Bit, DEFAULT_BASE_FRAME, sizeof(DEFAULT_BASE_FRAME)); // as begin () on each wake
+        DisplayList::show(a, vars);
+        draw(b, vars);
+        if (memcmp(a.DMemory4Bit, b.DMemory4Bit, sizeof(DEFAULT_BASE_FRAME)) != 0)
+        {
+            printf("wake %d: retained frame differs from the full draw\n", wake);
+            if (++bad > 5)
+                return 1;
+        }
+    }
+    printf("%d wakes, %d with the crosses changed: %s\n", wakes, crosses, bad ? "FAIL" : "OK");
+    return bad ? 1 : 0;
+}
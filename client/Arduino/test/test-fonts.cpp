@@ -0,0 +1,72 @@
+// the sketch's subset fonts (Fonts.hpp), drawn through the glyph cache (Glyphs.hpp) as the renderers draw them,
+// against the full fonts they were cut from: any text from the glyphs the subsets keep, at every rotation and in
+// every colour, must leave the same frame and the same cursor; then the sizes of the tables are compared
+#include <random>
+#include "Inkplate.h"
+namespace full
+{
+#include "fonts/FreeSansBold9pt7b.h"
+#include "fonts/Org_01.h"
+} // namespace full
+#include "Fonts.hpp"
+#include "Glyphs.hpp"
+
+static const int frame = E_INK_WIDTH * E_INK_HEIGHT / 4;
+
+// as FONTS in tools/fontSubset.py
+static const struct
+{
+    const GFXfont *subset, *full;
+    const char *glyphs;
+} fonts[] = {{&FreeSansBold9pt7b, &full::FreeSansBold9pt7b, " -.0123456789"}, {&Org_01, &full::Org_01, "hPa"}};
+
+int main()
+{
+    Inkplate a, b;
+    a.begin();
+    b.begin();
+    a.setGlyphCache(DEFAULT_GLYPHS, sizeof(DEFAULT_GLYPHS) / sizeof(DEFAULT_GLYPHS[0]));
+    a.setTextWrap(false);
+    b.setTextWrap(false);
+
+    std::mt19937 rng(9);
+    int bad = 0;
+    for (int r = 0; r < 4; r++)
+    {
+        a.setRotation(r);
+        b.setRotation(r);
+        for (int t = 0; t < 5000; t++)
+        {
+            const auto &font = fonts[t & 1];
+            char text[9];
+            const int length = 1 + rng() % 8;
+            for (int i = 0; i < length; i++)
+                text[i] = font.glyphs[rng() % strlen(font.glyphs)];
+            text[length] = '\0';
+            const int x = (int)(rng() % 240) - 20, y = (int)(rng() % 240) - 20, c = rng() % 3;
+            a.setFont(font.subset);
+            b.setFont(font.full);
+            a.setTextColor(c);
+            b.setTextColor(c);
+            a.setCursor(x, y);
+            b.setCursor(x, y);
+            a.print(text);
+            b.print(text);
+            if (a.getCursorX() != b.getCursorX() || a.getCursorY() != b.getCursorY() ||
+                memcmp(a.DMemory4Bit, b.DMemory4Bit, frame) != 0)
+            {
+                printf("rotation %d, '%s' at %d,%d differs\n", r, text, x, y);
+                memcpy(a.DMemory4Bit, b.DMemory4Bit, frame);
+                if (++bad > 5)
+                    return 1;
+            }
+        }
+    }
+    printf("20000 texts: %s\n", bad ? "FAIL" : "OK");
+
+    printf("FreeSansBold9pt7b %zu bytes, subset %zu; Org_01 %zu bytes, subset %zu\n",
+           sizeof(full::FreeSansBold9pt7bBitmaps) + sizeof(full::FreeSansBold9pt7bGlyphs),
+           sizeof(FreeSansBold9pt7bBitmaps) + sizeof(FreeSansBold9pt7bGlyphs),
+           sizeof(full::Org_01Bitmaps) + sizeof(full::Org_01Glyphs), sizeof(Org_01Bitmaps) + sizeof(Org_01Glyphs));
+    return bad ? 1 : 0;
+}
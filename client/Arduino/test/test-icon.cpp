@@ -0,0 +1,133 @@
+// Inkplate::drawIcon against drawBitmap: an icon packed here into the Icon format (as Inkplate.h describes it), raw
+// and PackBits compressed, for foreground and background colours including a transparent background, drawn at
+// random and partly clipped positions must leave the same frame; then both are timed
+#include <chrono>
+#include <random>
+#include <vector>
+#include "Inkplate.h"
+#include "icons/icon_tree.h"
+
+static const int size = 32, rotation = 1;
+
+// physical rows of: the mask of the pixels drawn, then plane 0 (cleared for black), then plane 1 (cleared for red);
+// at rotation 1 logical x, y within the icon is physical column y of row size - 1 - x
+static std::vector<uint8_t> pack(const uint8_t *bitmap, int fg, int bg)
+{
+    const int stride = (size + 7) / 8;
+    std::vector<uint8_t> packed(size * 3 * stride);
+    for (int y = 0; y < size; y++)
+        for (int x = 0; x < size; x++)
+        {
+            const int colour = bitmap[y * stride + x / 8] & (0x80 >> (x & 7)) ? fg : bg;
+            if (colour < 0)
+                continue;
+            const int px = y, py = size - 1 - x;
+            const uint8_t bit = 0x80 >> (px & 7);
+            uint8_t *row = packed.data() + py * 3 * stride + px / 8;
+            row[0] |= bit;
+            if (colour != INKPLATE2_BLACK)
+                row[stride] |= bit;
+            if (colour != INKPLATE2_RED)
+                row[2 * stride] |= bit;
+        }
+    return packed;
+}
+
+static std::vector<uint8_t> packbits(const std::vector<uint8_t> &data)
+{
+    std::vector<uint8_t> out;
+    size_t index = 0;
+    while (index < data.size())
+    {
+        size_t run = 1;
+        while (index + run < data.size() && run < 128 && data[index + run] == data[index])
+            run++;
+        if (run > 1)
+        {
+            out.push_back((uint8_t)(1 - (int)run));
+            out.push_back(data[index]);
+            index += run;
+            continue;
+        }
+        const size_t start = index;
+        while (index < data.size() && index - start < 128 && (index + 1 >= data.size() || data[index + 1] != data[index]))
+            index++;
+        if (index == start)
+            index++;
+        out.push_back((uint8_t)(index - start - 1));
+        out.insert(out.end(), data.begin() + start, data.begin() + index);
+    }
+    return out;
+}
+
+int main()
+{
+    static const int colours[][2] = {{INKPLATE2_BLACK, INKPLATE2_WHITE},
+                                     {INKPLATE2_BLACK, -1},
+                                     {INKPLATE2_RED, INKPLATE2_WHITE},
+                                     {INKPLATE2_RED, INKPLATE2_BLACK},
+                                     {INKPLATE2_WHITE, INKPLATE2_RED}};
+    const int cases = sizeof(colours) / sizeof(colours[0]);
+    std::vector<uint8_t> data[cases][2];
+    Icon icons[cases][2];
+    for (int n = 0; n < cases; n++)
+    {
+        data[n][0] = pack(icon_tree, colours[n][0], colours[n][1]);
+        data[n][1] = packbits(data[n][0]);
+        icons[n][0] = {rotation, 0, size, size, data[n][0].data()};
+        icons[n][1] = {rotation, ICON_RLE, size, size, data[n][1].data()};
+    }
+
+    Inkplate a, b;
+    a.begin();
+    b.begin();
+    a.setRotation(rotation);
+    b.setRotation(rotation);
+    std::mt19937 rng(5);
+    int bad = 0;
+    for (int t = 0; t < 20000; t++)
+    {
+        const int n = rng() % cases, rle = rng() % 2, x = (int)(rng() % 260) - 40, y = (int)(rng() % 150) - 40;
+        const bool clipped = t % 3 == 0;
+        if (clipped)
+        {
+            const int cx = (int)(rng() % 212), cy = (int)(rng() % 104), cw = rng() % 60, ch = rng() % 60;
+            a.pushClip(cx, cy, cw, ch);
+            b.pushClip(cx, cy, cw, ch);
+        }
+        a.drawIcon(x, y, &icons[n][rle]);
+        if (colours[n][1] < 0)
+            b.drawBitmap(x, y, icon_tree, size, size, colours[n][0]);
+        else
+            b.drawBitmap(x, y, icon_tree, size, size, colours[n][0], colours[n][1]);
+        if (clipped)
+        {
+            a.popClip();
+            b.popClip();
+        }
+        if (memcmp(a.DMemory4Bit, b.DMemory4Bit, E_INK_WIDTH * E_INK_HEIGHT / 4) != 0)
+        {
+            printf("t%d colours %d%s at %d,%d differs\n", t, n, rle ? " rle" : "", x, y);
+            memcpy(a.DMemory4Bit, b.DMemory4Bit, E_INK_WIDTH * E_INK_HEIGHT / 4);
+            if (++bad > 5)
+                return 1;
+        }
+    }
+    printf("drawIcon: %s\n", bad ? "FAIL" : "OK");
+
+    const int k = 100000;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < k; i++)
+        b.drawBitmap(4, 35, icon_tree, size, size, INKPLATE2_BLACK, INKPLATE2_WHITE);
+    const auto t1 = std::chrono::steady_clock::now();
+    for (int i = 0; i < k; i++)
+        a.drawIcon(4, 35, &icons[0][0]);
+    const auto t2 = std::chrono::steady_clock::now();
+    for (int i = 0; i < k; i++)
+        a.drawIcon(4, 35, &icons[0][1]);
+    const auto t3 = std::chrono::steady_clock::now();
+    const auto us = [&](std::chrono::steady_clock::duration d) { return std::chrono::duration<double, std::micro>(d).count() / k; };
+    printf("32x32 icon, %zu bytes raw, %zu rle: drawBitmap %.2f us, drawIcon %.2f us, rle %.2f us\n", data[0][0].size(), data[0][1].size(),
+           us(t1 - t0), us(t2 - t1), us(t3 - t2));
+    return bad ? 1 : 0;
+}
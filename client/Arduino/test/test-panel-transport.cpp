@@ -0,0 +1,60 @@
+// Inkplate::display over the recording spi_master driver (stub/stub.cpp): the bytes on the wire, each with its DC
+// level, must be the stream the panel was sent one command and data byte at a time before the transport was
+// queued; the queue must never hold more than the device was configured for, and must be empty whenever the
+// delay callback is called (it may light sleep, which would stop the SPI clock mid transaction)
+#include "Inkplate.h"
+#include "stub.h"
+
+static int pauses, pausesQueued;
+
+static void pause(uint32_t)
+{
+    pauses++;
+    pausesQueued += stub::outstanding > 0;
+}
+
+int main()
+{
+    Inkplate a;
+    a.begin();
+    a.setDelayCallback(pause);
+    for (int i = 0; i < E_INK_WIDTH * E_INK_HEIGHT / 4; i++)
+        a.DMemory4Bit[i] = i * 7;
+
+    const int plane = E_INK_WIDTH * E_INK_HEIGHT / 8;
+    std::vector<std::pair<int, int>> want;
+    const auto command = [&](int c) { want.push_back({0, c}); };
+    const auto data = [&](int d) { want.push_back({1, d}); };
+    command(0x04);
+    command(0x00), data(0x0f), data(0x89);
+    command(0x61), data(E_INK_WIDTH), data(E_INK_HEIGHT >> 8), data(E_INK_HEIGHT & 0xff);
+    command(0x50), data(0x77);
+    command(0x10);
+    for (int i = 0; i < plane; i++)
+        data(a.DMemory4Bit[i]);
+    command(0x13);
+    for (int i = 0; i < plane; i++)
+        data(a.DMemory4Bit[plane + i]);
+    command(0x11), data(0x00);
+    command(0x12);
+    command(0x50), data(0xf7);
+    command(0x02);
+    command(0x07), data(0xA5);
+
+    int bad = 0;
+    for (int n = 0; n < 2; n++)
+    {
+        stub::reset();
+        pauses = pausesQueued = 0;
+        const bool displayed = a.display();
+        const bool same = stub::wire == want;
+        const bool ok = displayed && same && stub::peak <= stub::device.queue_size && stub::failures == 0 &&
+                        !stub::added && pausesQueued == 0;
+        printf("display %d: %zu bytes, %s stream, queue peak %d of %d, %d failures, %d of %d pauses with transfers "
+               "queued, %d Hz: %s\n",
+               n + 1, stub::wire.size(), same ? "same" : "different", stub::peak, stub::device.queue_size,
+               stub::failures, pausesQueued, pauses, stub::device.clock_speed_hz, ok ? "OK" : "FAIL");
+        bad += !ok;
+    }
+    return bad ? 1 : 0;
+}
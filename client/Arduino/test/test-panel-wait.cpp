@@ -0,0 +1,76 @@
+// Inkplate's waits on the panel's busy line through the wait callback, against the stub panel (stub/stub.cpp)
+// whose busy line goes low with each command it works on: the callback must be asked for each of them rather
+// than the line being polled, the refresh wait with display()'s timeout; refreshMillis must report how long the
+// refresh kept the panel busy, to the timeout when it did not finish, and the panel must still be put to sleep
+#include <chrono>
+#include <thread>
+#include "Inkplate.h"
+#include "stub.h"
+
+static const uint32_t refreshing = 30;
+static bool finishes;
+static int calls, highs;
+static uint32_t asked;
+
+static int lastCommand()
+{
+    for (auto at = stub::wire.rbegin(); at != stub::wire.rend(); ++at)
+        if (at->first == 0)
+            return at->second;
+    return -1;
+}
+
+// as a light sleep until the line changes or the timeout: the refresh takes a while, or longer than the timeout
+static bool wait(uint8_t, uint8_t level, uint32_t timeout)
+{
+    calls++;
+    highs += level == HIGH;
+    if (lastCommand() == 0x12)
+    {
+        asked = timeout;
+        std::this_thread::sleep_for(std::chrono::milliseconds(finishes ? refreshing : timeout));
+        if (!finishes)
+            return false;
+    }
+    stub::level = 1;
+    return true;
+}
+
+static bool asleep()
+{
+    const size_t n = stub::wire.size();
+    return n >= 2 && stub::wire[n - 2] == std::make_pair(0, 0x07) && stub::wire[n - 1] == std::make_pair(1, 0xA5) &&
+           !stub::added;
+}
+
+int main()
+{
+    Inkplate a;
+    a.begin();
+    int bad = 0;
+
+    const bool unstarted = a.refreshMillis() == -1;
+    printf("before a refresh, refreshMillis %d: %s\n", (int)a.refreshMillis(), unstarted ? "OK" : "FAIL");
+    bad += !unstarted;
+
+    a.setWaitCallback(wait);
+    for (const uint32_t timeout : {30000u, 10u})
+    {
+        stub::reset();
+        stub::panel = true;
+        finishes = timeout > refreshing;
+        calls = highs = 0;
+        asked = 0;
+        const bool displayed = a.display(timeout);
+        const int32_t busy = a.refreshMillis();
+        const bool ok = displayed == finishes && calls == 3 && highs == 3 && asked == timeout &&
+                        busy >= (int32_t)(finishes ? refreshing : timeout) && busy < (int32_t)(refreshing + 1000) &&
+                        asleep();
+        printf("display(%u) %s: %d, refresh busy %d ms, %d waits (%d for high), refresh wait asked for %u ms, %s: "
+               "%s\n",
+               timeout, finishes ? "finishing" : "timing out", displayed, (int)busy, calls, highs, asked,
+               asleep() ? "asleep" : "not asleep", ok ? "OK" : "FAIL");
+        bad += !ok;
+    }
+    return bad ? 1 : 0;
+}
@@ -0,0 +1,151 @@
+// Shapes' integer ellipses, thick lines and gradient lines against the versions they replaced, as kept in the
+// Benchmark example's Legacy.h: the ellipses must be pixel identical; the float trigonometry drifts off the thick
+// line's corners, so both versions are compared with the rectangle rounded in double, which the integer version
+// must match in every case; the gradient line segments likewise against those at the exact fractions; then both
+// are timed
+#include <chrono>
+#include <cmath>
+#include <random>
+#include "Inkplate.h"
+#include "Legacy.h"
+
+// the rectangle of the thick line with its corner offsets rounded in double, halves toward the line, and the
+// triangles split along the same diagonal as both versions; the half thickness is taken in 16.16 as Shapes does
+static void exactThickLine(Inkplate &v, int x1, int y1, int x2, int y2, int color, float thickness)
+{
+    int dx = x2 - x1, dy = y2 - y1;
+    if (dx == 0 && dy == 0)
+        dx = 1;
+    const double length = sqrt((double)dx * dx + (double)dy * dy);
+    const auto rounded = [](double value) { return (int)(value < 0 ? -ceil(-value - 0.5) : ceil(value - 0.5)); };
+    const double half = floor(thickness * 32768.0 + 0.5) / 65536.0;
+    const int ox = rounded(-half * dy / length), oy = rounded(half * dx / length);
+    if (dx == 0 ? dy > 0 : (dy != 0 && (dx < 0) != (dy < 0)))
+    {
+        v.fillTriangle(x1 - ox, y1 - oy, x2 - ox, y2 - oy, x1 + ox, y1 + oy, color);
+        v.fillTriangle(x2 - ox, y2 - oy, x2 + ox, y2 + oy, x1 + ox, y1 + oy, color);
+    }
+    else
+    {
+        v.fillTriangle(x1 + ox, y1 + oy, x2 + ox, y2 + oy, x1 - ox, y1 - oy, color);
+        v.fillTriangle(x2 + ox, y2 + oy, x2 - ox, y2 - oy, x1 - ox, y1 - oy, color);
+    }
+}
+
+static const int frame = E_INK_WIDTH * E_INK_HEIGHT / 4;
+
+static int differ(const Inkplate &a, const Inkplate &b)
+{
+    int bits = 0;
+    for (int i = 0; i < frame; i++)
+        bits += __builtin_popcount(a.DMemory4Bit[i] ^ b.DMemory4Bit[i]);
+    return bits;
+}
+
+static void clear(Inkplate &a, Inkplate &b, Inkplate &c)
+{
+    memset(a.DMemory4Bit, 0xFF, frame);
+    memset(b.DMemory4Bit, 0xFF, frame);
+    memset(c.DMemory4Bit, 0xFF, frame);
+}
+
+template <typename F> static double timed(F f)
+{
+    const int k = 20000;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < k; i++)
+        f();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / k;
+}
+
+int main()
+{
+    Inkplate a, b, c;
+    a.begin();
+    b.begin();
+    c.begin();
+    std::mt19937 rng(13);
+    int bad = 0;
+
+    int differing = 0;
+    for (int t = 0; t < 20000; t++)
+    {
+        const int rx = rng() % 120, ry = rng() % 120, xc = rng() % 212, yc = rng() % 104, colour = 1 + rng() % 2;
+        clear(a, b, c);
+        legacy_drawElipse(a, rx, ry, xc, yc, colour);
+        b.drawElipse(rx, ry, xc, yc, colour);
+        differing += differ(a, b) > 0;
+    }
+    printf("drawElipse: %d/20000 differ: %s\n", differing, differing ? "FAIL" : "OK");
+    bad += differing;
+
+    differing = 0;
+    for (int t = 0; t < 20000; t++)
+    {
+        const int rx = rng() % 120, ry = rng() % 120, xc = rng() % 212, yc = rng() % 104, colour = 1 + rng() % 2;
+        clear(a, b, c);
+        legacy_fillElipse(a, rx, ry, xc, yc, colour);
+        b.fillElipse(rx, ry, xc, yc, colour);
+        differing += differ(a, b) > 0;
+    }
+    printf("fillElipse: %d/20000 differ: %s\n", differing, differing ? "FAIL" : "OK");
+    bad += differing;
+
+    int floats = 0, floatBits = 0;
+    differing = 0;
+    for (int t = 0; t < 20000; t++)
+    {
+        int x1 = rng() % 212, y1 = rng() % 104, x2 = rng() % 212, y2 = rng() % 104, colour = 1 + rng() % 2;
+        const float thickness = (rng() % 200) / 10.0f;
+        if (t % 10 == 0)
+            x2 = x1;
+        if (t % 10 == 1)
+            y2 = y1;
+        if (t % 50 == 2)
+            x2 = x1, y2 = y1;
+        clear(a, b, c);
+        legacy_drawThickLine(a, x1, y1, x2, y2, colour, thickness);
+        b.drawThickLine(x1, y1, x2, y2, colour, thickness);
+        exactThickLine(c, x1, y1, x2, y2, colour, thickness);
+        const int bits = differ(a, c);
+        floats += bits > 0;
+        floatBits += bits;
+        differing += differ(b, c) > 0;
+    }
+    printf("drawThickLine: float %d/20000 off the exact rounding (%d bits), integer %d/20000: %s\n", floats, floatBits,
+           differing, differing ? "FAIL" : "OK");
+    bad += differing;
+
+    floats = floatBits = differing = 0;
+    for (int t = 0; t < 20000; t++)
+    {
+        const int x1 = (int)(rng() % 400) - 100, y1 = (int)(rng() % 300) - 100, x2 = (int)(rng() % 400) - 100,
+                  y2 = (int)(rng() % 300) - 100, n = 1 + rng() % 30, first = 1 - (int)(rng() % n);
+        // only colours 1 and 2 show on white, so each case draws segments 1 - first and 2 - first
+        clear(a, b, c);
+        legacy_drawGradientLine(a, x1, y1, x2, y2, first, first + n, -1);
+        b.drawGradientLine(x1, y1, x2, y2, first, first + n, -1);
+        const auto at = [n](int from, int to, int i) { return (int)(from + (long double)i * (to - from) / n); };
+        for (int i = 0; i < n; i++)
+            c.drawLine(at(x1, x2, i), at(y1, y2, i), at(x1, x2, i + 1), at(y1, y2, i + 1), first + i);
+        const int bits = differ(a, c);
+        floats += bits > 0;
+        floatBits += bits;
+        differing += differ(b, c) > 0;
+    }
+    printf("drawGradientLine: float %d/20000 off the exact fractions (%d bits), integer %d/20000: %s\n", floats,
+           floatBits, differing, differing ? "FAIL" : "OK");
+    bad += differing;
+
+    printf("drawElipse 90x45: float %.2f us, integer %.2f us\n",
+           timed([&] { legacy_drawElipse(a, 90, 45, 106, 52, 1); }), timed([&] { b.drawElipse(90, 45, 106, 52, 1); }));
+    printf("fillElipse 90x45: per pixel %.2f us, spans %.2f us\n",
+           timed([&] { legacy_fillElipse(a, 90, 45, 106, 52, 1); }), timed([&] { b.fillElipse(90, 45, 106, 52, 1); }));
+    printf("drawThickLine 5px: float %.2f us, integer %.2f us\n",
+           timed([&] { legacy_drawThickLine(a, 10, 90, 200, 12, 1, 5.0f); }),
+           timed([&] { b.drawThickLine(10, 90, 200, 12, 1, 5.0f); }));
+    printf("drawGradientLine 3 segments: float %.2f us, integer %.2f us\n",
+           timed([&] { legacy_drawGradientLine(a, 10, 90, 200, 12, 0, 3, 3.0f); }),
+           timed([&] { b.drawGradientLine(10, 90, 200, 12, 0, 3, 3.0f); }));
+    return bad ? 1 : 0;
+}
@@ -1,9 +1,10 @@
 // -----------------------------------------------------------------------------------------------------------------------------------------
 // -----------------------------------------------------------------------------------------------------------------------------------------
 
+const fs = require('fs');
 const { formatInTimeZone } = require('date-fns-tz');
 
-function initialise(app, prefix, vars, tz, debug) {
+function initialise(app, prefix, vars, tz, schedule, clients, debug) {
     const variablesSet = {};
     function render() {
         return Object.fromEntries(vars.map((topic) => [topic, variablesSet[topic]]));
@@ -12,31 +13,127 @@ function initialise(app, prefix, vars, tz, debug) {
         if (vars.some((vars_topic) => topic.startsWith(vars_topic))) {
             variablesSet[topic] = { ...content, timestamp: formatInTimeZone(new Date(), tz, "yyyy-MM-dd'T'HH:mm:ssXXX'Z'").replace(":00'Z", 'Z') };
             console.log(`variables: '${topic}' --> '${JSON.stringify(variablesSet[topic])}'`);
+            arrival(topic, Date.now());
             return true;
         }
         return false;
     }
+
+    //
+
+    // publish cadence per topic (median of recent inter-arrival times), so clients can wake just after the next update
+    const arrivalsSet = {};
+    const arrivalsKept = 8;
+    function arrival(topic, now) {
+        const arrivals = (arrivalsSet[topic] ??= { last: undefined, intervals: [] });
+        if (arrivals.last !== undefined) {
+            arrivals.intervals.push(now - arrivals.last);
+            if (arrivals.intervals.length > arrivalsKept) arrivals.intervals.shift();
+        }
+        arrivals.last = now;
+    }
+    function cadence(topic) {
+        const arrivals = arrivalsSet[topic];
+        if (!arrivals || arrivals.intervals.length === 0) return undefined;
+        const sorted = [...arrivals.intervals].sort((a, b) => a - b);
+        return { last: arrivals.last, cadence: sorted[Math.floor(sorted.length / 2)] };
+    }
+    function next(now) {
+        let hint;
+        for (const topic of schedule) {
+            const topic_cadence = cadence(topic);
+            if (!topic_cadence || topic_cadence.cadence <= 0) continue;
+            let topic_next = topic_cadence.last + topic_cadence.cadence;
+            while (topic_next <= now) topic_next += topic_cadence.cadence;
+            hint = { next: Math.max(hint?.next || 0, topic_next), cadence: Math.max(hint?.cadence || 0, topic_cadence.cadence) };
+        }
+        return hint ? { next: Math.ceil(hint.next / 1000), cadence: Math.round(hint.cadence / 1000) } : {};
+    }
+
+    // wake slot per client (its position in the clients file), so the fleet spreads its requests evenly; the file is checked for
+    // changes at most once per interval, not on every request
+    let clientsList = [],
+        clientsModified = 0,
+        clientsChecked = 0;
+    const clientsInterval = 60 * 1000;
+    function slot(mac) {
+        if (!mac || !clients) return {};
+        try {
+            const now = Date.now();
+            if (now - clientsChecked >= clientsInterval) {
+                clientsChecked = now;
+                const modified = fs.statSync(clients).mtimeMs;
+                if (modified !== clientsModified) {
+                    clientsList = Object.keys(JSON.parse(fs.readFileSync(clients, 'utf8')));
+                    clientsModified = modified;
+                }
+            }
+        } catch (e) {
+            console.error(`vars slot failed: error reading client file, error:`, e);
+            return {};
+        }
+        const index = clientsList.indexOf(mac);
+        return index < 0 ? {} : { slot: index, slots: clientsList.length };
+    }
     function variables() {
         return variablesSet;
     }
 
     //
 
+    // latest telemetry per client, most recent last, dropping clients not heard from within the expiry
+    const clientsSet = {};
+    const clientsKept = 64,
+        clientsExpiry = 24 * 60 * 60 * 1000;
+    const requests = { active: 0, total: 0, peakConcurrent: 0, peakPerSecond: 0, second: 0, perSecond: 0 };
+    function request(res) {
+        const second = Math.floor(Date.now() / 1000);
+        if (second !== requests.second) {
+            requests.second = second;
+            requests.perSecond = 0;
+        }
+        requests.total++;
+        requests.peakConcurrent = Math.max(requests.peakConcurrent, ++requests.active);
+        requests.peakPerSecond = Math.max(requests.peakPerSecond, ++requests.perSecond);
+        res.on('close', () => requests.active--);
+    }
+    function telemetry(query) {
+        const { mac, ...content } = query;
+        if (!mac) return;
+        const now = Date.now();
+        delete clientsSet[mac];
+        clientsSet[mac] = { ...content, timestamp: new Date(now).toISOString() };
+        for (const [client, { timestamp }] of Object.entries(clientsSet))
+            if (Object.keys(clientsSet).length > clientsKept || now - Date.parse(timestamp) > clientsExpiry) delete clientsSet[client];
+            else break;
+        console.log(`vars telemetry: '${mac}' --> '${JSON.stringify(content)}'`);
+    }
+    function getDiagnostics() {
+        const { active, total, peakConcurrent, peakPerSecond } = requests;
+        return { clients: clientsSet, requests: { active, total, peakConcurrent, peakPerSecond } };
+    }
+
+    //
+
     app.get(String(prefix) + '', (req, res) => {
         debug && console.log(`vars requested from '${req.headers['x-forwarded-for'] || req.connection.remoteAddress}'`);
-        res.json(variablesSet);
+        request(res);
+        telemetry(req.query);
+        const now = Date.now(),
+            hint = { ...next(now), ...slot(req.query.mac) };
+        res.json({ ...variablesSet, timestamp: Math.floor(now / 1000), schedule: Object.keys(hint).length > 0 ? hint : undefined });
     });
 
     //
 
-    return { update, render, variables };
+    return { update, render, variables, getDiagnostics };
 }
 
 // -----------------------------------------------------------------------------------------------------------------------------------------
 // -----------------------------------------------------------------------------------------------------------------------------------------
 
 module.exports = function (app, prefix, options) {
-    return initialise(app, prefix, options.vars || {}, options.tz || '');
+    return initialise(app, prefix, options.vars || {}, options.tz || '', options.schedule || options.vars || [], options.clients);
 };
 
 // -----------------------------------------------------------------------------------------------------------------------------------------
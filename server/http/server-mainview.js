@@ -13,6 +13,7 @@ const configList = Object.entries(configData)
     .join(', ');
 configData.CONTENT_DATA_SUBS = ['weather/#', 'sensors/#', 'snapshots/#', 'alert/#'];
 configData.CONTENT_VIEW_VARS = ['weather/ulrikashus', 'weather/branna', 'sensors/radiation', 'aviation_alerts', 'aviation_weather', 'interpretation'];
+configData.CONTENT_VIEW_SCHEDULE = ['weather/ulrikashus', 'weather/branna'];
 configData.DIAGNOSTICS_PUBLISH_TOPIC = 'server/mainview';
 configData.DIAGNOSTICS_PUBLISH_PERIOD = 60;
 configData.DATA_VIEWS = path.join(configData.DATA, 'http');
@@ -158,8 +159,11 @@ const server_vars = require('./server-function-vars.js')(app, '/vars', {
     vars: configData.CONTENT_VIEW_VARS,
     location: configData.LOCATION,
     tz: configData.TZ,
+    schedule: configData.CONTENT_VIEW_SCHEDULE,
+    clients: configData.FILE_SETS,
 });
-console.log(`Loaded 'vars' on '/vars' using 'vars=[${configData.CONTENT_VIEW_VARS.join(', ')}]'`);
+console.log(`Loaded 'vars' on '/vars' using 'vars=[${configData.CONTENT_VIEW_VARS.join(', ')}], schedule=[${configData.CONTENT_VIEW_SCHEDULE.join(', ')}]'`);
+diagnostics.registerDiagnosticsSource('Vars::/vars', () => server_vars.getDiagnostics());
 
 const cacheMainview = require('./server-function-cache-ejs.js')(path.join(configData.DATA_VIEWS, 'server-mainview.ejs'), { minifyOutput: false });
 diagnostics.registerDiagnosticsSource('Cache::/mainview', () => cacheMainview.getDiagnostics());
@@ -0,0 +1,89 @@
+#!/usr/bin/env node
+
+// -----------------------------------------------------------------------------------------------------------------------------------------
+// -----------------------------------------------------------------------------------------------------------------------------------------
+
+// simulates a fleet of displays waking against /vars and reports the peak concurrent requests after the first (common) wake, for each
+// of: free running (no schedule), aligned to the data update hint, and either of those spread by the per-device slot; the wake arithmetic
+// follows Scheduler::align in client/Arduino/Weather_Inkplate2/Schedule.hpp, the slot assignment follows slot() in http/server-function-vars.js
+//
+// usage: node test-schedule-slots.js [displays] [hours] [seed]
+
+const displays = parseInt(process.argv[2]) || 8;
+const hours = parseInt(process.argv[3]) || 24;
+const seed = parseInt(process.argv[4]) || 1;
+
+const bootSpread = 2; // secs over which the displays boot together (e.g. after a power cut)
+const clockDrift = 0.02; // deep sleep timer error, at most either way
+const requestSecs = 2; // connect, fetch and parse
+const interval = 300; // secs, as configured on the displays
+const cadence = 60; // secs between data updates on the server
+
+const scheduleMin = 120,
+    scheduleMax = 1800,
+    scheduleMargin = 10,
+    scheduleSlotWindow = 60; // DEFAULT_SCHEDULE_* in Config.hpp
+
+// -----------------------------------------------------------------------------------------------------------------------------------------
+
+let random = seed;
+function uniform() {
+    random = (random * 1103515245 + 12345) % 2147483648;
+    return random / 2147483648;
+}
+
+function align(now, secs, slot, hint) {
+    const maximum = Math.max(secs, scheduleMax);
+    let wake;
+    if (hint) {
+        const until = hint.next - now + scheduleMargin;
+        wake = until + Math.trunc(slot * Math.min(hint.cadence, scheduleSlotWindow));
+        if (secs > wake) wake += Math.trunc((secs - wake + Math.trunc(hint.cadence / 2)) / hint.cadence) * hint.cadence;
+        while (wake < scheduleMin) wake += hint.cadence;
+    } else {
+        let phase = ((((Math.trunc(slot * secs) - (now + secs)) % secs) + secs) % secs);
+        if (phase > secs / 2) phase -= secs;
+        wake = Math.max(secs + phase, scheduleMin);
+    }
+    return Math.min(wake, maximum);
+}
+
+function simulate(hinted, slotted) {
+    random = seed;
+    const fleet = Array.from({ length: displays }, (_, index) => ({
+        wake: uniform() * bootSpread,
+        drift: 1 + (uniform() * 2 - 1) * clockDrift,
+        slot: slotted ? index / displays : 0,
+    }));
+    const requests = [];
+    for (const display of fleet)
+        for (let first = true; display.wake < hours * 3600; first = false) {
+            if (!first) requests.push([display.wake, display.wake + requestSecs]);
+            const now = Math.floor(display.wake + requestSecs),
+                next = (Math.floor(now / cadence) + 1) * cadence;
+            const secs = hinted || slotted ? align(now, interval, display.slot, hinted ? { next, cadence } : undefined) : interval;
+            display.wake += requestSecs + secs * display.drift;
+        }
+    const events = requests.flatMap(([start, end]) => [[start, 1], [end, -1]]).sort((a, b) => a[0] - b[0] || a[1] - b[1]);
+    let active = 0,
+        peak = 0;
+    for (const [, change] of events) peak = Math.max(peak, (active += change));
+    return { requests: requests.length + displays, peak };
+}
+
+// -----------------------------------------------------------------------------------------------------------------------------------------
+// -----------------------------------------------------------------------------------------------------------------------------------------
+
+console.log(`${displays} displays booting within ${bootSpread}s, ±${clockDrift * 100}% drift, ${requestSecs}s requests, ${interval}s interval, ${cadence}s data cadence, over ${hours}h`);
+for (const [name, hinted, slotted] of [
+    ['free running', false, false],
+    ['hint aligned', true, false],
+    ['slotted', false, true],
+    ['slotted, hint aligned', true, true],
+]) {
+    const { requests, peak } = simulate(hinted, slotted);
+    console.log(`${name.padEnd(24)} ${String(requests).padStart(6)} requests, peak ${peak} concurrent`);
+}
+
+// -----------------------------------------------------------------------------------------------------------------------------------------
+// -----------------------------------------------------------------------------------------------------------------------------------------